@@ -0,0 +1,125 @@
+// benches/benches/hot_paths.rs
+// Criterion benchmarks for the proven hot paths. Run with `cargo bench`;
+// use `cargo bench -- --save-baseline <name>` before a change and
+// `cargo bench -- --baseline <name>` after to gate on regressions.
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion};
+
+use bytes::Bytes;
+use finalverse_events::events::{Event, EventType, PlayerEvent, PlayerId, Coordinates};
+use finalverse_events::{EventCodec, GameEventBus, LocalEventBus};
+use finalverse_world3d::entities::{Entity, PlayerEntity, ResonanceScore};
+use finalverse_world3d::entity_store::EntityStore;
+use finalverse_world3d::terrain::{TerrainGenerator, Biome};
+use finalverse_world3d::terrain_generator::{GridCoordinate as GenCoordinate, NoiseEngine};
+use finalverse_world3d::terrain_streaming::encode_terrain_tiles;
+use finalverse_world3d::{EntityId, GridCoordinate, Position3D};
+use uuid::Uuid;
+
+fn bench_heightmap_generation(c: &mut Criterion) {
+    let engine = NoiseEngine::new(7);
+    let mut group = c.benchmark_group("terrain/generate_heightmap");
+    group.sample_size(10);
+
+    for lod in [0u32, 1, 3] {
+        group.bench_with_input(BenchmarkId::new("lod", lod), &lod, |b, &lod| {
+            b.iter(|| {
+                black_box(engine.generate_heightmap_lod(GenCoordinate::new(3, -2), lod))
+            })
+        });
+    }
+    group.finish();
+}
+
+fn bench_event_bus_fanout(c: &mut Criterion) {
+    let rt = tokio::runtime::Runtime::new().unwrap();
+    let mut group = c.benchmark_group("events/publish_fanout");
+
+    for subscribers in [1usize, 8, 64] {
+        let bus = LocalEventBus::new();
+        rt.block_on(async {
+            for _ in 0..subscribers {
+                bus.subscribe_bytes("bench.topic", Box::new(|payload| {
+                    black_box(payload.len());
+                }))
+                .await
+                .unwrap();
+            }
+        });
+
+        let payload = Bytes::from(vec![0u8; 256]);
+        group.bench_with_input(
+            BenchmarkId::new("subscribers", subscribers),
+            &subscribers,
+            |b, _| {
+                b.iter(|| {
+                    rt.block_on(bus.publish_bytes("bench.topic", payload.clone()))
+                        .unwrap()
+                })
+            },
+        );
+    }
+    group.finish();
+}
+
+fn bench_terrain_tile_encoding(c: &mut Criterion) {
+    let generator = TerrainGenerator::new(7);
+    let patch =
+        generator.generate_grid_terrain(GridCoordinate::new(3, -2), 0.8, Biome::WhisperwoodGrove);
+
+    c.bench_function("terrain/encode_terrain_tiles", |b| {
+        b.iter(|| black_box(encode_terrain_tiles(&patch)))
+    });
+}
+
+fn bench_event_codec(c: &mut Criterion) {
+    let event = Event::new(EventType::Player(PlayerEvent::Moved {
+        player_id: PlayerId("bench-player".to_string()),
+        from: Coordinates { x: 1.0, y: 2.0, z: 3.0 },
+        to: Coordinates { x: 4.0, y: 5.0, z: 6.0 },
+    }));
+
+    let mut group = c.benchmark_group("events/codec");
+    for (name, codec) in [("json", EventCodec::Json), ("bincode", EventCodec::Bincode)] {
+        group.bench_function(BenchmarkId::new("encode", name), |b| {
+            b.iter(|| black_box(codec.encode(&event).unwrap()))
+        });
+        let frame = codec.encode(&event).unwrap();
+        group.bench_function(BenchmarkId::new("decode", name), |b| {
+            b.iter(|| black_box(EventCodec::decode(&frame).unwrap()))
+        });
+    }
+    group.finish();
+}
+
+fn bench_entity_interest_check(c: &mut Criterion) {
+    let mut group = c.benchmark_group("entities/ids_in_radius");
+
+    for count in [100usize, 1_000, 10_000] {
+        let mut store = EntityStore::new();
+        for i in 0..count {
+            store.insert(Entity::Player(PlayerEntity {
+                id: EntityId(Uuid::new_v4()),
+                name: format!("p{}", i),
+                position: Position3D::new((i % 100) as f32 * 2.5, 0.0, (i / 100) as f32 * 2.5),
+                resonance: ResonanceScore::default(),
+            }));
+        }
+
+        group.bench_with_input(BenchmarkId::new("entities", count), &count, |b, _| {
+            b.iter(|| {
+                black_box(store.ids_in_radius(Position3D::new(125.0, 0.0, 125.0), 50.0))
+            })
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(
+    hot_paths,
+    bench_heightmap_generation,
+    bench_event_bus_fanout,
+    bench_terrain_tile_encoding,
+    bench_event_codec,
+    bench_entity_interest_check,
+);
+criterion_main!(hot_paths);
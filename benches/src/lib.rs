@@ -0,0 +1,3 @@
+// benches/src/lib.rs
+// Intentionally empty: this crate only exists to host the criterion
+// benchmark targets under benches/.
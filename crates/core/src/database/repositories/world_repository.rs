@@ -4,10 +4,13 @@
 //              Handles all database operations for worlds.
 
 use super::{Repository, RepositoryError};
-use crate::database::connection::DbConnection;
+use crate::database::connection::{DbConnection, DbPool};
 use crate::database::schema::worlds;
 use crate::models::world_state::{WorldState, WorldSong, WorldStatistics};
 use diesel::prelude::*;
+use std::collections::HashMap;
+use std::sync::{Arc, Mutex};
+use std::time::Duration;
 use uuid::Uuid;
 use chrono::Utc;
 use serde_json;
@@ -171,6 +174,147 @@ impl Repository for WorldRepository {
     }
 }
 
+/// How often queued harmony/discord writes are flushed to Postgres.
+const WRITE_BEHIND_FLUSH_INTERVAL: Duration = Duration::from_secs(2);
+
+/// Async repository layer over `WorldRepository`. Owns the connection pool
+/// and runs every diesel call on the blocking thread pool, so world-engine's
+/// tokio workers never block on Postgres.
+///
+/// High-frequency harmony/discord updates go through a write-behind queue:
+/// `queue_harmony_discord` is keep-latest per world and a background task
+/// flushes the whole queue as one batched UPDATE per interval. Everything
+/// durability-critical keeps the direct path.
+pub struct AsyncWorldRepository {
+    pool: DbPool,
+    pending_harmony: Arc<Mutex<HashMap<Uuid, (f32, f32)>>>,
+}
+
+impl AsyncWorldRepository {
+    pub fn new(pool: DbPool) -> Arc<Self> {
+        let repo = Arc::new(Self {
+            pool,
+            pending_harmony: Arc::new(Mutex::new(HashMap::new())),
+        });
+
+        let flusher = repo.clone();
+        tokio::spawn(async move {
+            let mut interval = tokio::time::interval(WRITE_BEHIND_FLUSH_INTERVAL);
+            interval.set_missed_tick_behavior(tokio::time::MissedTickBehavior::Skip);
+            loop {
+                interval.tick().await;
+                if let Err(e) = flusher.flush_harmony_discord().await {
+                    tracing::warn!("Write-behind harmony flush failed: {}", e);
+                }
+            }
+        });
+
+        repo
+    }
+
+    /// Run a sync repository call on the blocking pool with a pooled
+    /// connection.
+    async fn with_conn<T, F>(&self, f: F) -> Result<T, RepositoryError>
+    where
+        T: Send + 'static,
+        F: FnOnce(&mut DbConnection) -> Result<T, RepositoryError> + Send + 'static,
+    {
+        let pool = self.pool.clone();
+        tokio::task::spawn_blocking(move || {
+            let mut conn = pool
+                .get()
+                .map_err(|e| RepositoryError::ConnectionError(e.to_string()))?;
+            f(&mut conn)
+        })
+        .await
+        .map_err(|e| RepositoryError::ConnectionError(e.to_string()))?
+    }
+
+    pub async fn find_by_id(&self, id: Uuid) -> Result<WorldState, RepositoryError> {
+        self.with_conn(move |conn| WorldRepository::new().find_by_id(conn, id))
+            .await
+    }
+
+    pub async fn find_by_name(&self, name: &str) -> Result<WorldState, RepositoryError> {
+        let name = name.to_string();
+        self.with_conn(move |conn| WorldRepository::new().find_by_name(conn, &name))
+            .await
+    }
+
+    pub async fn create(&self, entity: WorldState) -> Result<WorldState, RepositoryError> {
+        self.with_conn(move |conn| WorldRepository::new().create(conn, entity))
+            .await
+    }
+
+    pub async fn update(&self, entity: WorldState) -> Result<WorldState, RepositoryError> {
+        self.with_conn(move |conn| WorldRepository::new().update(conn, entity))
+            .await
+    }
+
+    /// Direct, durable harmony/discord write. Use for updates that must hit
+    /// the database before the caller proceeds.
+    pub async fn update_harmony_discord(
+        &self,
+        world_id: Uuid,
+        harmony: f32,
+        discord: f32,
+    ) -> Result<(), RepositoryError> {
+        self.with_conn(move |conn| {
+            WorldRepository::new().update_harmony_discord(conn, world_id, harmony, discord)
+        })
+        .await
+    }
+
+    /// Write-behind harmony/discord update: keep-latest per world, persisted
+    /// by the flusher. Hot counters only — a crash loses at most one flush
+    /// interval of updates.
+    pub fn queue_harmony_discord(&self, world_id: Uuid, harmony: f32, discord: f32) {
+        self.pending_harmony
+            .lock()
+            .unwrap()
+            .insert(world_id, (harmony, discord));
+    }
+
+    /// Flush all queued harmony/discord updates as a single batched UPDATE.
+    pub async fn flush_harmony_discord(&self) -> Result<(), RepositoryError> {
+        let pending: Vec<(Uuid, (f32, f32))> = {
+            let mut queue = self.pending_harmony.lock().unwrap();
+            queue.drain().collect()
+        };
+        if pending.is_empty() {
+            return Ok(());
+        }
+
+        self.with_conn(move |conn| {
+            use diesel::sql_types::{Array, Float4, Uuid as SqlUuid};
+
+            let ids: Vec<Uuid> = pending.iter().map(|(id, _)| *id).collect();
+            let harmonies: Vec<f32> = pending.iter().map(|(_, (h, _))| *h).collect();
+            let discords: Vec<f32> = pending.iter().map(|(_, (_, d))| *d).collect();
+
+            // One statement for the whole batch: unnest the parallel arrays
+            // and join against worlds
+            diesel::sql_query(
+                "UPDATE worlds AS w \
+                 SET global_harmony = v.harmony, \
+                     global_discord = v.discord, \
+                     updated_at = now() \
+                 FROM (SELECT unnest($1::uuid[]) AS id, \
+                              unnest($2::real[]) AS harmony, \
+                              unnest($3::real[]) AS discord) AS v \
+                 WHERE w.id = v.id",
+            )
+            .bind::<Array<SqlUuid>, _>(ids)
+            .bind::<Array<Float4>, _>(harmonies)
+            .bind::<Array<Float4>, _>(discords)
+            .execute(conn)?;
+
+            Ok(())
+        })
+        .await
+    }
+}
+
 // Database record structs
 #[derive(Queryable, Debug)]
 struct WorldRecord {
@@ -0,0 +1,53 @@
+// crates/events/src/codec.rs
+use bytes::{BufMut, Bytes, BytesMut};
+
+use crate::events::Event;
+
+/// Version of the binary event frame. Bumped if the frame layout changes.
+pub const FRAME_VERSION: u8 = 1;
+
+/// Codec id stored in the frame after the version byte.
+const CODEC_BINCODE: u8 = 1;
+
+/// Wire encoding for typed events, selected per bus instance.
+///
+/// `Json` emits bare JSON exactly as before, so a bus on the new code can
+/// publish to subscribers still running the old code. `Bincode` prefixes a
+/// compact binary body with `[FRAME_VERSION, codec]`; since JSON text never
+/// starts with 0x01, decoders can tell the two apart and a mixed fleet
+/// interoperates during rollout.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum EventCodec {
+    #[default]
+    Json,
+    Bincode,
+}
+
+impl EventCodec {
+    pub fn encode(self, event: &Event) -> anyhow::Result<Bytes> {
+        match self {
+            EventCodec::Json => Ok(Bytes::from(serde_json::to_vec(event)?)),
+            EventCodec::Bincode => {
+                let body = bincode::serialize(event)?;
+                let mut frame = BytesMut::with_capacity(2 + body.len());
+                frame.put_u8(FRAME_VERSION);
+                frame.put_u8(CODEC_BINCODE);
+                frame.put_slice(&body);
+                Ok(frame.freeze())
+            }
+        }
+    }
+
+    /// Decode a frame produced by any codec (the frame identifies itself),
+    /// independent of which codec this bus publishes with.
+    pub fn decode(payload: &[u8]) -> anyhow::Result<Event> {
+        match payload.first() {
+            Some(&FRAME_VERSION) => match payload.get(1) {
+                Some(&CODEC_BINCODE) => Ok(bincode::deserialize(&payload[2..])?),
+                other => anyhow::bail!("unknown event codec id {:?}", other),
+            },
+            // No version byte: legacy bare-JSON frame
+            _ => Ok(serde_json::from_slice(payload)?),
+        }
+    }
+}
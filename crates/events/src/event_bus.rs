@@ -1,26 +1,63 @@
 // crates/events/src/event_bus.rs
 use async_trait::async_trait;
+use bytes::Bytes;
+use crate::codec::EventCodec;
 use crate::events::Event;
 
 #[async_trait]
 pub trait GameEventBus: Send + Sync {
-    /// Publish raw bytes to a topic
-    async fn publish_raw(&self, topic: &str, payload: Vec<u8>) -> anyhow::Result<()>;
-    
-    /// Subscribe to raw bytes from a topic
+    /// Codec used when publishing typed events. Decoding sniffs the frame
+    /// itself, so buses with different codecs interoperate.
+    fn codec(&self) -> EventCodec {
+        EventCodec::Json
+    }
+
+    /// Publish a reference-counted payload to a topic. This is the primitive
+    /// publish path: the same `Bytes` is shared by every subscriber without
+    /// copying.
+    async fn publish_bytes(&self, topic: &str, payload: Bytes) -> anyhow::Result<()>;
+
+    /// Subscribe to a topic, receiving the shared payload bytes.
+    async fn subscribe_bytes(
+        &self,
+        topic: &str,
+        handler: Box<dyn Fn(Bytes) + Send + Sync + 'static>,
+    ) -> anyhow::Result<String>;
+
+    /// Publish a burst of payloads to one topic. Implementations may pipeline
+    /// the whole batch into a single transport flush; the default just
+    /// publishes sequentially.
+    async fn publish_batch(&self, topic: &str, payloads: Vec<Bytes>) -> anyhow::Result<()> {
+        for payload in payloads {
+            self.publish_bytes(topic, payload).await?;
+        }
+        Ok(())
+    }
+
+    /// Publish raw bytes to a topic. `Vec<u8>` converts into `Bytes` without
+    /// copying, so this is a thin wrapper kept for existing callers.
+    async fn publish_raw(&self, topic: &str, payload: Vec<u8>) -> anyhow::Result<()> {
+        self.publish_bytes(topic, Bytes::from(payload)).await
+    }
+
+    /// Subscribe to raw bytes from a topic. Copies the payload into an owned
+    /// `Vec<u8>` per delivery; prefer `subscribe_bytes` on hot paths.
     async fn subscribe_raw(
         &self,
         topic: &str,
         handler: Box<dyn Fn(Vec<u8>) + Send + Sync + 'static>,
-    ) -> anyhow::Result<String>;
-    
+    ) -> anyhow::Result<String> {
+        self.subscribe_bytes(topic, Box::new(move |payload| handler(payload.to_vec())))
+            .await
+    }
+
     /// Publish a typed event
     async fn publish(&self, event: Event) -> anyhow::Result<()> {
         let topic = event.topic();
-        let payload = serde_json::to_vec(&event)?;
-        self.publish_raw(&topic, payload).await
+        let payload = self.codec().encode(&event)?;
+        self.publish_bytes(&topic, payload).await
     }
-    
+
     /// Subscribe to typed events
     async fn subscribe(
         &self,
@@ -28,17 +65,17 @@ pub trait GameEventBus: Send + Sync {
         handler: Box<dyn Fn(Event) + Send + Sync + 'static>,
     ) -> anyhow::Result<String> {
         let topic = topic.to_string();
-        self.subscribe_raw(
+        self.subscribe_bytes(
             &topic,
             Box::new(move |payload| {
-                if let Ok(event) = serde_json::from_slice::<Event>(&payload) {
+                if let Ok(event) = EventCodec::decode(&payload) {
                     handler(event);
                 }
             }),
         )
         .await
     }
-    
+
     /// Unsubscribe from a topic
     async fn unsubscribe(&self, subscription_id: &str) -> anyhow::Result<()>;
-}
\ No newline at end of file
+}
@@ -1,9 +1,12 @@
 // crates/events/src/lib.rs
+pub mod codec;
 pub mod event_bus;
 pub mod events;
 pub mod nats;
 pub mod local;
+pub mod topic;
 
+pub use codec::EventCodec;
 pub use event_bus::GameEventBus;
 pub use events::*;
 pub use nats::NatsEventBus;
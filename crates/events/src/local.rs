@@ -1,22 +1,49 @@
 // crates/events/src/local.rs
-use tokio::sync::{broadcast, RwLock};
-use std::sync::Arc;
-use std::collections::HashMap;
+use bytes::Bytes;
+use dashmap::DashMap;
+use tokio::sync::broadcast;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Arc, RwLock};
 use uuid::Uuid;
 
+use crate::codec::EventCodec;
 use crate::event_bus::GameEventBus;
+use crate::topic::{has_wildcards, TopicTrie};
 
-/// Local in-memory event bus for testing and single-node deployments
+/// Local in-memory event bus for testing and single-node deployments.
+///
+/// Payloads travel as reference-counted `Bytes` (one allocation per publish,
+/// shared by every subscriber) and the topic map is a sharded `DashMap`, so
+/// publishers on different topics never contend on one lock. Wildcard
+/// patterns (`world.region.*.harmony`, `world.>`) go through a topic trie
+/// consulted only when wildcard subscriptions exist.
 pub struct LocalEventBus {
-    channels: Arc<RwLock<HashMap<String, broadcast::Sender<Vec<u8>>>>>,
-    subscriptions: Arc<RwLock<HashMap<String, broadcast::Receiver<Vec<u8>>>>>,
+    channels: Arc<DashMap<String, broadcast::Sender<Bytes>>>,
+    subscriptions: Arc<DashMap<String, broadcast::Receiver<Bytes>>>,
+    // Wildcard subscriptions: (subscription id, sender) per pattern
+    wildcards: Arc<RwLock<TopicTrie<(String, broadcast::Sender<Bytes>)>>>,
+    // subscription id -> pattern, so unsubscribe can reach into the trie
+    wildcard_patterns: Arc<DashMap<String, String>>,
+    // Lets the publish hot path skip the trie lock entirely when nobody
+    // subscribed with wildcards
+    wildcard_count: Arc<AtomicUsize>,
+    codec: EventCodec,
 }
 
 impl LocalEventBus {
     pub fn new() -> Self {
+        Self::with_codec(EventCodec::default())
+    }
+
+    /// Bus publishing typed events with the given codec.
+    pub fn with_codec(codec: EventCodec) -> Self {
         Self {
-            channels: Arc::new(RwLock::new(HashMap::new())),
-            subscriptions: Arc::new(RwLock::new(HashMap::new())),
+            channels: Arc::new(DashMap::new()),
+            subscriptions: Arc::new(DashMap::new()),
+            wildcards: Arc::new(RwLock::new(TopicTrie::new())),
+            wildcard_patterns: Arc::new(DashMap::new()),
+            wildcard_count: Arc::new(AtomicUsize::new(0)),
+            codec,
         }
     }
 }
@@ -29,55 +56,84 @@ impl Default for LocalEventBus {
 
 #[async_trait::async_trait]
 impl GameEventBus for LocalEventBus {
-    async fn publish_raw(&self, topic: &str, payload: Vec<u8>) -> anyhow::Result<()> {
-        let channels = self.channels.read().await;
-        
-        if let Some(sender) = channels.get(topic) {
-            // Ignore send errors (no receivers)
-            let _ = sender.send(payload);
+    fn codec(&self) -> EventCodec {
+        self.codec
+    }
+
+    async fn publish_bytes(&self, topic: &str, payload: Bytes) -> anyhow::Result<()> {
+        if let Some(sender) = self.channels.get(topic) {
+            // Ignore send errors (no receivers); subscribers share `payload`
+            // via its refcount rather than receiving copies.
+            let _ = sender.send(payload.clone());
         }
-        
+
+        if self.wildcard_count.load(Ordering::Relaxed) > 0 {
+            let trie = self.wildcards.read().unwrap();
+            trie.for_each_match(topic, |(_, sender)| {
+                // Cloning `Bytes` only bumps the refcount
+                let _ = sender.send(payload.clone());
+            });
+        }
+
         Ok(())
     }
 
-    async fn subscribe_raw(
+    async fn subscribe_bytes(
         &self,
         topic: &str,
-        handler: Box<dyn Fn(Vec<u8>) + Send + Sync + 'static>,
+        handler: Box<dyn Fn(Bytes) + Send + Sync + 'static>,
     ) -> anyhow::Result<String> {
         let subscription_id = Uuid::new_v4().to_string();
-        
-        // Get or create channel for topic
-        let receiver = {
-            let mut channels = self.channels.write().await;
-            let sender = channels.entry(topic.to_string())
+
+        let receiver = if has_wildcards(topic) {
+            // Pattern subscription: its own channel, registered in the trie
+            let (tx, rx) = broadcast::channel(1000);
+            self.wildcards
+                .write()
+                .unwrap()
+                .insert(topic, (subscription_id.clone(), tx));
+            self.wildcard_patterns
+                .insert(subscription_id.clone(), topic.to_string());
+            self.wildcard_count.fetch_add(1, Ordering::Relaxed);
+            rx
+        } else {
+            // Get or create channel for topic (locks only the owning shard)
+            self.channels
+                .entry(topic.to_string())
                 .or_insert_with(|| {
                     let (tx, _) = broadcast::channel(1000);
                     tx
-                });
-            sender.subscribe()
+                })
+                .subscribe()
         };
-        
+
         // Store receiver
-        self.subscriptions.write().await.insert(subscription_id.clone(), receiver);
-        
+        self.subscriptions.insert(subscription_id.clone(), receiver);
+
         // Spawn handler task
         let sub_id_clone = subscription_id.clone();
         let subscriptions = self.subscriptions.clone();
         tokio::spawn(async move {
-            if let Some(mut receiver) = subscriptions.write().await.remove(&sub_id_clone) {
+            if let Some((_, mut receiver)) = subscriptions.remove(&sub_id_clone) {
                 let handler = handler;
                 while let Ok(payload) = receiver.recv().await {
                     handler(payload);
                 }
             }
         });
-        
+
         Ok(subscription_id)
     }
-    
+
     async fn unsubscribe(&self, subscription_id: &str) -> anyhow::Result<()> {
-        self.subscriptions.write().await.remove(subscription_id);
+        self.subscriptions.remove(subscription_id);
+        if let Some((_, pattern)) = self.wildcard_patterns.remove(subscription_id) {
+            self.wildcards
+                .write()
+                .unwrap()
+                .remove(&pattern, |(id, _)| id == subscription_id);
+            self.wildcard_count.fetch_sub(1, Ordering::Relaxed);
+        }
         Ok(())
     }
-}
\ No newline at end of file
+}
@@ -1,65 +1,166 @@
 // crates/events/src/nats.rs
+use bytes::Bytes;
 use futures_util::StreamExt;
 use async_nats::{Client, Subscriber};
-use tokio::sync::RwLock;
+use tokio::sync::{mpsc, RwLock};
 use std::sync::Arc;
 use std::collections::HashMap;
+use std::time::Duration;
 use uuid::Uuid;
 
+use crate::codec::EventCodec;
 use crate::event_bus::GameEventBus;
 
+/// Queued events are flushed to the server once this many have accumulated...
+const BATCH_FLUSH_THRESHOLD: usize = 256;
+
+/// ...or when this interval elapses, whichever comes first. Sub-millisecond
+/// so batching never adds player-visible latency.
+const BATCH_FLUSH_INTERVAL: Duration = Duration::from_micros(500);
+
 pub struct NatsEventBus {
-    client: Arc<RwLock<Client>>,
+    // async-nats clients are cheaply cloneable handles over one connection,
+    // so no lock is needed around them.
+    client: Client,
     subscriptions: Arc<RwLock<HashMap<String, Subscriber>>>,
+    batch_tx: mpsc::UnboundedSender<(String, Bytes)>,
+    codec: EventCodec,
 }
 
 impl NatsEventBus {
     pub async fn new(nats_url: &str) -> anyhow::Result<Self> {
+        Self::with_codec(nats_url, EventCodec::default()).await
+    }
+
+    /// Bus publishing typed events with the given codec.
+    pub async fn with_codec(nats_url: &str, codec: EventCodec) -> anyhow::Result<Self> {
         let client = async_nats::connect(nats_url).await?;
+        let (batch_tx, batch_rx) = mpsc::unbounded_channel();
+
+        tokio::spawn(run_batch_flusher(client.clone(), batch_rx));
+
         Ok(Self {
-            client: Arc::new(RwLock::new(client)),
+            client,
             subscriptions: Arc::new(RwLock::new(HashMap::new())),
+            batch_tx,
+            codec,
         })
     }
+
+    /// Queue a payload for the background batcher instead of awaiting a
+    /// publish. Intended for hot emitters (e.g. per-tick world events)
+    /// that would otherwise serialize a burst on individual publish
+    /// awaits; delivery happens within BATCH_FLUSH_INTERVAL.
+    pub fn queue_publish(&self, topic: &str, payload: Bytes) {
+        let _ = self.batch_tx.send((topic.to_string(), payload));
+    }
+}
+
+/// Accumulates queued events and flushes them when either the size threshold
+/// or the flush timer fires, so a burst costs one server round trip.
+async fn run_batch_flusher(
+    client: Client,
+    mut batch_rx: mpsc::UnboundedReceiver<(String, Bytes)>,
+) {
+    let mut pending: Vec<(String, Bytes)> = Vec::with_capacity(BATCH_FLUSH_THRESHOLD);
+    let mut interval = tokio::time::interval(BATCH_FLUSH_INTERVAL);
+    interval.set_missed_tick_behavior(tokio::time::MissedTickBehavior::Skip);
+
+    loop {
+        tokio::select! {
+            msg = batch_rx.recv() => {
+                match msg {
+                    Some(entry) => {
+                        pending.push(entry);
+                        if pending.len() >= BATCH_FLUSH_THRESHOLD {
+                            flush_pending(&client, &mut pending).await;
+                        }
+                    }
+                    None => {
+                        // Bus dropped: flush what is left and stop
+                        flush_pending(&client, &mut pending).await;
+                        break;
+                    }
+                }
+            }
+            _ = interval.tick() => {
+                flush_pending(&client, &mut pending).await;
+            }
+        }
+    }
+}
+
+async fn flush_pending(client: &Client, pending: &mut Vec<(String, Bytes)>) {
+    if pending.is_empty() {
+        return;
+    }
+    let mut dropped = 0usize;
+    for (topic, payload) in pending.drain(..) {
+        // publish only enqueues on the client's write buffer; the flush below
+        // pushes the whole batch over the wire at once
+        if client.publish(topic, payload).await.is_err() {
+            dropped += 1;
+        }
+    }
+    if dropped > 0 {
+        tracing::warn!("dropped {} queued events (publish failed)", dropped);
+    }
+    if let Err(e) = client.flush().await {
+        tracing::warn!("event batch flush failed: {}", e);
+    }
 }
 
 #[async_trait::async_trait]
 impl GameEventBus for NatsEventBus {
-    async fn publish_raw(&self, topic: &str, payload: Vec<u8>) -> anyhow::Result<()> {
-        self.client
-            .read()
-            .await
-            .publish(topic.to_string(), payload.into())
-            .await?;
+    fn codec(&self) -> EventCodec {
+        self.codec
+    }
+
+    async fn publish_bytes(&self, topic: &str, payload: Bytes) -> anyhow::Result<()> {
+        // async-nats takes Bytes natively, so the payload is never copied
+        self.client.publish(topic.to_string(), payload).await?;
         Ok(())
     }
 
-    async fn subscribe_raw(
+    async fn publish_batch(&self, topic: &str, payloads: Vec<Bytes>) -> anyhow::Result<()> {
+        for payload in payloads {
+            self.client.publish(topic.to_string(), payload).await?;
+        }
+        // One explicit flush pipelines the whole burst
+        self.client.flush().await?;
+        Ok(())
+    }
+
+    async fn subscribe_bytes(
         &self,
         topic: &str,
-        handler: Box<dyn Fn(Vec<u8>) + Send + Sync + 'static>,
+        handler: Box<dyn Fn(Bytes) + Send + Sync + 'static>,
     ) -> anyhow::Result<String> {
-        let subscriber = self.client.read().await.subscribe(topic.to_string()).await?;
+        // Patterns use NATS subject wildcard syntax (`*` for one segment,
+        // `>` for the rest), so they map straight onto a native server-side
+        // subscription — filtering happens before anything is delivered,
+        // matching the trie semantics in LocalEventBus.
+        let subscriber = self.client.subscribe(topic.to_string()).await?;
         let subscription_id = Uuid::new_v4().to_string();
-        
+
         let sub_id_clone = subscription_id.clone();
         let subscriptions = self.subscriptions.clone();
-        
+
         // Store the subscriber
         subscriptions.write().await.insert(sub_id_clone.clone(), subscriber);
-        
+
         // Spawn handler task
         tokio::spawn(async move {
             let mut sub = subscriptions.write().await.remove(&sub_id_clone).unwrap();
             let handler = handler;
             while let Some(msg) = sub.next().await {
-                handler(msg.payload.to_vec());
+                handler(msg.payload);
             }
         });
-        
+
         Ok(subscription_id)
     }
-    
+
     async fn unsubscribe(&self, subscription_id: &str) -> anyhow::Result<()> {
         self.subscriptions.write().await.remove(subscription_id);
         Ok(())
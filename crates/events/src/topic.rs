@@ -0,0 +1,194 @@
+// crates/events/src/topic.rs
+// Hierarchical topic matching. Topics are dot-separated subjects
+// ("world.region.7.harmony"); subscription patterns may use the NATS
+// wildcards `*` (exactly one segment) and `>` (one or more trailing
+// segments). The trie resolves a published topic to every matching
+// subscription in one walk, so filtering happens on the subject string
+// before any payload is deserialized.
+use std::collections::HashMap;
+
+/// Whether a subscription pattern needs trie dispatch at all — exact
+/// topics keep their direct channel.
+pub fn has_wildcards(pattern: &str) -> bool {
+    pattern
+        .split('.')
+        .any(|segment| segment == "*" || segment == ">")
+}
+
+#[derive(Debug)]
+struct TrieNode<T> {
+    children: HashMap<String, TrieNode<T>>,
+    // Subtree behind a `*` segment
+    single: Option<Box<TrieNode<T>>>,
+    // Subscribers whose pattern ended in `>` here
+    tail: Vec<T>,
+    // Subscribers whose pattern ends exactly here
+    terminal: Vec<T>,
+}
+
+impl<T> Default for TrieNode<T> {
+    fn default() -> Self {
+        Self {
+            children: HashMap::new(),
+            single: None,
+            tail: Vec::new(),
+            terminal: Vec::new(),
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct TopicTrie<T> {
+    root: TrieNode<T>,
+    len: usize,
+}
+
+impl<T> Default for TopicTrie<T> {
+    fn default() -> Self {
+        Self {
+            root: TrieNode::default(),
+            len: 0,
+        }
+    }
+}
+
+impl<T> TopicTrie<T> {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Number of stored subscriptions.
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    pub fn insert(&mut self, pattern: &str, value: T) {
+        let mut node = &mut self.root;
+        for segment in pattern.split('.') {
+            match segment {
+                ">" => {
+                    node.tail.push(value);
+                    self.len += 1;
+                    return;
+                }
+                "*" => node = node.single.get_or_insert_with(Default::default),
+                _ => node = node.children.entry(segment.to_string()).or_default(),
+            }
+        }
+        node.terminal.push(value);
+        self.len += 1;
+    }
+
+    /// Remove every subscription under `pattern` for which `matches`
+    /// returns true.
+    pub fn remove(&mut self, pattern: &str, matches: impl Fn(&T) -> bool) {
+        let mut node = &mut self.root;
+        for segment in pattern.split('.') {
+            match segment {
+                ">" => {
+                    let before = node.tail.len();
+                    node.tail.retain(|v| !matches(v));
+                    self.len -= before - node.tail.len();
+                    return;
+                }
+                "*" => match node.single.as_deref_mut() {
+                    Some(next) => node = next,
+                    None => return,
+                },
+                _ => match node.children.get_mut(segment) {
+                    Some(next) => node = next,
+                    None => return,
+                },
+            }
+        }
+        let before = node.terminal.len();
+        node.terminal.retain(|v| !matches(v));
+        self.len -= before - node.terminal.len();
+    }
+
+    /// Visit every subscription whose pattern matches `topic`.
+    pub fn for_each_match(&self, topic: &str, mut visit: impl FnMut(&T)) {
+        let segments: Vec<&str> = topic.split('.').collect();
+        Self::walk(&self.root, &segments, &mut visit);
+    }
+
+    fn walk<'a>(node: &'a TrieNode<T>, remaining: &[&str], visit: &mut impl FnMut(&'a T)) {
+        // `>` requires at least one remaining segment
+        if !remaining.is_empty() {
+            for value in &node.tail {
+                visit(value);
+            }
+        }
+
+        let Some((segment, rest)) = remaining.split_first() else {
+            for value in &node.terminal {
+                visit(value);
+            }
+            return;
+        };
+
+        if let Some(next) = node.children.get(*segment) {
+            Self::walk(next, rest, visit);
+        }
+        if let Some(next) = node.single.as_deref() {
+            Self::walk(next, rest, visit);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn matches(trie: &TopicTrie<&'static str>, topic: &str) -> Vec<&'static str> {
+        let mut out = Vec::new();
+        trie.for_each_match(topic, |v| out.push(*v));
+        out.sort();
+        out
+    }
+
+    #[test]
+    fn test_wildcard_matching() {
+        let mut trie = TopicTrie::new();
+        trie.insert("world.region.*.harmony", "per_region_harmony");
+        trie.insert("world.region.7.harmony", "region_7_only");
+        trie.insert("world.>", "all_world");
+        trie.insert("events.player", "players_exact");
+
+        assert_eq!(
+            matches(&trie, "world.region.7.harmony"),
+            vec!["all_world", "per_region_harmony", "region_7_only"]
+        );
+        assert_eq!(
+            matches(&trie, "world.region.12.harmony"),
+            vec!["all_world", "per_region_harmony"]
+        );
+        // `*` matches exactly one segment, `>` needs at least one
+        assert_eq!(matches(&trie, "world.region.harmony"), vec!["all_world"]);
+        assert_eq!(matches(&trie, "world"), Vec::<&str>::new());
+        assert_eq!(matches(&trie, "events.player"), vec!["players_exact"]);
+
+        assert!(has_wildcards("world.region.*.harmony"));
+        assert!(!has_wildcards("events.player"));
+    }
+
+    #[test]
+    fn test_remove() {
+        let mut trie = TopicTrie::new();
+        trie.insert("world.*.harmony", "a");
+        trie.insert("world.*.harmony", "b");
+        trie.insert("world.>", "c");
+        assert_eq!(trie.len(), 3);
+
+        trie.remove("world.*.harmony", |v| *v == "a");
+        assert_eq!(trie.len(), 2);
+        assert_eq!(matches(&trie, "world.region.harmony"), vec!["b", "c"]);
+
+        trie.remove("world.>", |_| true);
+        assert_eq!(matches(&trie, "world.region.harmony"), vec!["b"]);
+    }
+}
@@ -1,9 +1,91 @@
 // crates/grpc-client/src/lib.rs
 use tonic::transport::{Channel, Endpoint};
+use std::collections::HashMap;
+use std::sync::OnceLock;
 use std::time::Duration;
+use tokio::sync::RwLock;
+use finalverse_config::GrpcServiceRegistry;
 use finalverse_proto::world::world_service_client::WorldServiceClient;
 use finalverse_proto::story::story_service_client::StoryServiceClient;
 
+/// Process-wide channel manager: one lazily-established HTTP/2 channel per
+/// target, shared by every caller, so cross-service calls multiplex over an
+/// existing connection instead of paying setup each time. HTTP/2 keepalive
+/// pings double as the health check — a dead channel reconnects on the next
+/// call rather than handing out broken streams.
+pub struct ChannelManager {
+    channels: RwLock<HashMap<String, Channel>>,
+}
+
+impl ChannelManager {
+    pub fn new() -> Self {
+        Self {
+            channels: RwLock::new(HashMap::new()),
+        }
+    }
+
+    /// The shared manager for this process.
+    pub fn global() -> &'static ChannelManager {
+        static GLOBAL: OnceLock<ChannelManager> = OnceLock::new();
+        GLOBAL.get_or_init(ChannelManager::new)
+    }
+
+    /// Channel for `target` (e.g. "http://127.0.0.1:50051"). Cloning a
+    /// tonic Channel is cheap and shares the underlying connection, so
+    /// every caller multiplexes over the same HTTP/2 session.
+    pub async fn channel(&self, target: &str) -> Result<Channel, tonic::transport::Error> {
+        if let Some(channel) = self.channels.read().await.get(target) {
+            return Ok(channel.clone());
+        }
+
+        let mut channels = self.channels.write().await;
+        // Re-check: another task may have raced us to the write lock
+        if let Some(channel) = channels.get(target) {
+            return Ok(channel.clone());
+        }
+
+        // connect_lazy: the channel establishes itself on first use and
+        // transparently re-establishes after failures, so entries never
+        // need to be evicted on error
+        let channel = endpoint(target)?.connect_lazy();
+        channels.insert(target.to_string(), channel.clone());
+        Ok(channel)
+    }
+
+    /// Pre-connect to every service in the registry (normally the
+    /// `[grpc.services]` table from `crates/config/finalverse.toml`), so
+    /// the first real call after startup already has a warm connection.
+    /// Unreachable services are skipped — their channels connect lazily
+    /// once they come up.
+    pub async fn warm_up(&self, registry: &GrpcServiceRegistry) {
+        for (name, addr) in &registry.services {
+            let target = format!("http://{}", addr);
+            match self.channel(&target).await {
+                // Poke the lazy channel so the TCP+HTTP/2 handshake happens
+                // now instead of on the first request
+                Ok(channel) => {
+                    let mut client =
+                        tonic::client::Grpc::new(channel);
+                    let _ = client.ready().await;
+                }
+                Err(e) => {
+                    eprintln!("grpc warm-up for {} ({}) failed: {}", name, target, e);
+                }
+            }
+        }
+    }
+}
+
+fn endpoint(target: &str) -> Result<Endpoint, tonic::transport::Error> {
+    Ok(Endpoint::from_shared(target.to_string())?
+        .connect_timeout(Duration::from_secs(5))
+        .timeout(Duration::from_secs(10))
+        .tcp_keepalive(Some(Duration::from_secs(60)))
+        .http2_keep_alive_interval(Duration::from_secs(30))
+        .keep_alive_timeout(Duration::from_secs(5))
+        .keep_alive_while_idle(true))
+}
+
 #[derive(Clone)]
 pub struct FinalverseGrpcClient {
     pub world: WorldServiceClient<Channel>,
@@ -15,8 +97,9 @@ impl FinalverseGrpcClient {
         world_addr: &str,
         story_addr: &str,
     ) -> Result<Self, Box<dyn std::error::Error>> {
-        let world_channel = create_channel(world_addr).await?;
-        let story_channel = create_channel(story_addr).await?;
+        let manager = ChannelManager::global();
+        let world_channel = manager.channel(world_addr).await?;
+        let story_channel = manager.channel(story_addr).await?;
 
         Ok(Self {
             world: WorldServiceClient::new(world_channel),
@@ -25,14 +108,6 @@ impl FinalverseGrpcClient {
     }
 }
 
-async fn create_channel(addr: &str) -> Result<Channel, tonic::transport::Error> {
-    Endpoint::from_shared(addr.to_string())?
-        .connect_timeout(Duration::from_secs(5))
-        .timeout(Duration::from_secs(10))
-        .connect()
-        .await
-}
-
 // Convenience functions for common operations
 pub mod helpers {
     use super::*;
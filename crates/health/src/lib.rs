@@ -9,6 +9,9 @@ use tokio::sync::RwLock;
 use warp::{Filter, Rejection, Reply};
 use axum::{routing::get, Router, Json, http::StatusCode, response::IntoResponse};
 
+pub mod metrics;
+pub use metrics::{Counter, Histogram, Metrics};
+
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct HealthStatus {
     pub service: String,
@@ -73,6 +76,7 @@ pub struct HealthMonitor {
     start_time: Instant,
     checks: Arc<RwLock<Vec<Box<dyn HealthChecker + Send + Sync>>>>,
     metrics: Arc<RwLock<HealthMetrics>>,
+    hot_metrics: Metrics,
 }
 
 #[async_trait::async_trait]
@@ -144,8 +148,16 @@ impl HealthMonitor {
             start_time: Instant::now(),
             checks: Arc::new(RwLock::new(Vec::new())),
             metrics: Arc::new(RwLock::new(HealthMetrics::default())),
+            hot_metrics: Metrics::new(),
         }
     }
+
+    /// Wait-free counters and histograms for hot paths. The returned
+    /// handle is cheap to clone and updates never take a lock; values
+    /// are aggregated only when `/metrics` is scraped.
+    pub fn hot_metrics(&self) -> Metrics {
+        self.hot_metrics.clone()
+    }
     
     pub async fn add_checker(&self, checker: Box<dyn HealthChecker + Send + Sync>) {
         let mut checks = self.checks.write().await;
@@ -227,7 +239,14 @@ impl HealthMonitor {
                 })
         };
         
-        health.or(info)
+        let metrics_route = {
+            let monitor = Arc::clone(&self);
+            warp::path("metrics")
+                .and(warp::get())
+                .map(move || monitor.hot_metrics.render())
+        };
+
+        health.or(info).or(metrics_route)
     }
 
     /// Create Axum routes for health and info endpoints.
@@ -262,7 +281,18 @@ impl HealthMonitor {
             })
         };
 
-        Router::new().route("/health", health_route).route("/info", info_route)
+        let metrics_route = {
+            let monitor = Arc::clone(&self);
+            get(move || {
+                let monitor = Arc::clone(&monitor);
+                async move { monitor.hot_metrics.render() }
+            })
+        };
+
+        Router::new()
+            .route("/health", health_route)
+            .route("/info", info_route)
+            .route("/metrics", metrics_route)
     }
 }
 
@@ -0,0 +1,253 @@
+// libs/health/src/metrics.rs
+// Wait-free hot-path metrics. Counters are sharded across padded atomics
+// so concurrent increments from different threads don't contend on one
+// cache line; histograms bucket latencies into fixed bounds at record
+// time. Nothing locks on the write side — aggregation happens lazily
+// when `/metrics` or `/health` is scraped.
+use dashmap::DashMap;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+use std::time::Duration;
+
+const SHARDS: usize = 16;
+
+/// Upper bounds of the latency buckets, in microseconds. Chosen to
+/// resolve everything from a sub-millisecond event publish to a
+/// multi-second grid generation.
+const BUCKET_BOUNDS_US: [u64; 14] = [
+    100, 250, 500, 1_000, 2_500, 5_000, 10_000, 25_000, 50_000, 100_000, 250_000, 500_000,
+    1_000_000, 5_000_000,
+];
+
+/// One atomic per cache line so shards never false-share.
+#[repr(align(64))]
+#[derive(Default)]
+struct PaddedCounter(AtomicU64);
+
+thread_local! {
+    // Stable per-thread shard pick; consecutive threads land on
+    // consecutive shards
+    static SHARD: usize = {
+        use std::sync::atomic::AtomicUsize;
+        static NEXT: AtomicUsize = AtomicUsize::new(0);
+        NEXT.fetch_add(1, Ordering::Relaxed) % SHARDS
+    };
+}
+
+#[derive(Default)]
+pub struct Counter {
+    shards: [PaddedCounter; SHARDS],
+}
+
+impl Counter {
+    pub fn increment(&self) {
+        self.add(1);
+    }
+
+    pub fn add(&self, n: u64) {
+        let shard = SHARD.with(|s| *s);
+        self.shards[shard].0.fetch_add(n, Ordering::Relaxed);
+    }
+
+    pub fn value(&self) -> u64 {
+        self.shards
+            .iter()
+            .map(|s| s.0.load(Ordering::Relaxed))
+            .sum()
+    }
+}
+
+pub struct Histogram {
+    // One slot per bound plus an overflow bucket
+    buckets: [AtomicU64; BUCKET_BOUNDS_US.len() + 1],
+    count: AtomicU64,
+    sum_us: AtomicU64,
+}
+
+impl Default for Histogram {
+    fn default() -> Self {
+        Self {
+            buckets: Default::default(),
+            count: AtomicU64::new(0),
+            sum_us: AtomicU64::new(0),
+        }
+    }
+}
+
+impl Histogram {
+    pub fn record(&self, latency: Duration) {
+        self.record_us(latency.as_micros() as u64);
+    }
+
+    pub fn record_us(&self, us: u64) {
+        let idx = BUCKET_BOUNDS_US
+            .iter()
+            .position(|&bound| us <= bound)
+            .unwrap_or(BUCKET_BOUNDS_US.len());
+        self.buckets[idx].fetch_add(1, Ordering::Relaxed);
+        self.count.fetch_add(1, Ordering::Relaxed);
+        self.sum_us.fetch_add(us, Ordering::Relaxed);
+    }
+
+    /// Time a closure and record its latency.
+    pub fn time<T>(&self, f: impl FnOnce() -> T) -> T {
+        let start = std::time::Instant::now();
+        let result = f();
+        self.record(start.elapsed());
+        result
+    }
+
+    pub fn count(&self) -> u64 {
+        self.count.load(Ordering::Relaxed)
+    }
+
+    /// Estimated quantile (`q` in 0..=1) in microseconds, resolved to the
+    /// upper bound of the bucket the quantile falls in.
+    pub fn quantile_us(&self, q: f64) -> u64 {
+        let total = self.count();
+        if total == 0 {
+            return 0;
+        }
+        let rank = ((total as f64) * q).ceil() as u64;
+        let mut seen = 0u64;
+        for (idx, bucket) in self.buckets.iter().enumerate() {
+            seen += bucket.load(Ordering::Relaxed);
+            if seen >= rank {
+                return BUCKET_BOUNDS_US.get(idx).copied().unwrap_or(u64::MAX);
+            }
+        }
+        u64::MAX
+    }
+}
+
+/// Named counters and histograms, created on first use. Cloning shares
+/// the underlying instruments.
+#[derive(Clone, Default)]
+pub struct Metrics {
+    counters: Arc<DashMap<String, Arc<Counter>>>,
+    histograms: Arc<DashMap<String, Arc<Histogram>>>,
+}
+
+impl Metrics {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn counter(&self, name: &str) -> Arc<Counter> {
+        if let Some(counter) = self.counters.get(name) {
+            return counter.clone();
+        }
+        self.counters
+            .entry(name.to_string())
+            .or_default()
+            .clone()
+    }
+
+    pub fn histogram(&self, name: &str) -> Arc<Histogram> {
+        if let Some(histogram) = self.histograms.get(name) {
+            return histogram.clone();
+        }
+        self.histograms
+            .entry(name.to_string())
+            .or_default()
+            .clone()
+    }
+
+    /// Prometheus text exposition of every instrument. Walks the shards
+    /// and buckets only when scraped.
+    pub fn render(&self) -> String {
+        let mut out = String::new();
+
+        let mut counters: Vec<_> = self
+            .counters
+            .iter()
+            .map(|e| (e.key().clone(), e.value().value()))
+            .collect();
+        counters.sort();
+        for (name, value) in counters {
+            out.push_str(&format!("# TYPE {} counter\n{} {}\n", name, name, value));
+        }
+
+        let mut histograms: Vec<_> = self
+            .histograms
+            .iter()
+            .map(|e| (e.key().clone(), e.value().clone()))
+            .collect();
+        histograms.sort_by(|a, b| a.0.cmp(&b.0));
+        for (name, histogram) in histograms {
+            out.push_str(&format!("# TYPE {} histogram\n", name));
+            let mut cumulative = 0u64;
+            for (idx, bound) in BUCKET_BOUNDS_US.iter().enumerate() {
+                cumulative += histogram.buckets[idx].load(Ordering::Relaxed);
+                out.push_str(&format!(
+                    "{}_bucket{{le=\"{}\"}} {}\n",
+                    name,
+                    *bound as f64 / 1_000_000.0,
+                    cumulative
+                ));
+            }
+            out.push_str(&format!(
+                "{}_bucket{{le=\"+Inf\"}} {}\n",
+                name,
+                histogram.count()
+            ));
+            out.push_str(&format!(
+                "{}_sum {}\n",
+                name,
+                histogram.sum_us.load(Ordering::Relaxed) as f64 / 1_000_000.0
+            ));
+            out.push_str(&format!("{}_count {}\n", name, histogram.count()));
+        }
+
+        out
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_counter_sums_across_threads() {
+        let metrics = Metrics::new();
+        let counter = metrics.counter("requests_total");
+
+        let handles: Vec<_> = (0..8)
+            .map(|_| {
+                let counter = metrics.counter("requests_total");
+                std::thread::spawn(move || {
+                    for _ in 0..1000 {
+                        counter.increment();
+                    }
+                })
+            })
+            .collect();
+        for handle in handles {
+            handle.join().unwrap();
+        }
+
+        assert_eq!(counter.value(), 8000);
+        assert!(metrics.render().contains("requests_total 8000"));
+    }
+
+    #[test]
+    fn test_histogram_quantiles_and_render() {
+        let metrics = Metrics::new();
+        let histogram = metrics.histogram("tick_latency_seconds");
+
+        for _ in 0..99 {
+            histogram.record_us(400); // lands in the le=500µs bucket
+        }
+        histogram.record_us(2_000_000); // one slow outlier
+
+        assert_eq!(histogram.count(), 100);
+        assert_eq!(histogram.quantile_us(0.5), 500);
+        assert_eq!(histogram.quantile_us(0.99), 500);
+        assert_eq!(histogram.quantile_us(1.0), 5_000_000);
+
+        let text = metrics.render();
+        assert!(text.contains("# TYPE tick_latency_seconds histogram"));
+        assert!(text.contains("tick_latency_seconds_count 100"));
+        assert!(text.contains("tick_latency_seconds_bucket{le=\"+Inf\"} 100"));
+    }
+}
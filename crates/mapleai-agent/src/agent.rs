@@ -41,13 +41,29 @@ impl Agent {
         self.state.context = ctx;
     }
 
-    pub async fn step(&mut self) {
+    pub fn set_bridge(&mut self, bridge: LLMBridge) {
+        self.bridge = bridge;
+    }
+
+    /// Cheap reactive path: re-plan from utility rules only. This is what
+    /// the scheduler runs for every agent every tick.
+    pub fn step_reactive(&mut self) {
         let action = self.planner.plan(&self.state.context);
         self.state.last_action = Some(action);
+    }
+
+    /// Expensive path: consult the LLM bridge and fold the reasoning into
+    /// memory. Budgeted and rate-limited by the scheduler.
+    pub async fn escalate(&mut self) {
         let reasoning = self.bridge.reason(&self.state).await;
         self.state.context.memory.push(reasoning);
     }
 
+    pub async fn step(&mut self) {
+        self.step_reactive();
+        self.escalate().await;
+    }
+
     pub fn spawn(mut self) -> AgentHandle {
         let handle = tokio::spawn(async move {
             loop {
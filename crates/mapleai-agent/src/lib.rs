@@ -1,5 +1,7 @@
 pub mod agent;
 pub mod planner;
 pub mod llm_bridge;
+pub mod scheduler;
 
 pub use agent::{Agent, AgentHandle};
+pub use scheduler::{AgentScheduler, SchedulerConfig};
@@ -0,0 +1,268 @@
+// Steps agent populations in parallel batches with a per-tick LLM budget.
+// Every agent runs the cheap reactive path (planner rules) each tick; the
+// LLM bridge is only consulted when an agent's situation materially
+// changes, and even then escalations are queued and drained at a bounded
+// rate, so NPC count scales with CPU rather than LLM throughput.
+use crate::Agent;
+use finalverse_protocol::ReasoningContext;
+use std::collections::{HashMap, HashSet, VecDeque};
+use std::hash::{Hash, Hasher};
+use tokio::task::JoinSet;
+
+#[derive(Clone)]
+pub struct SchedulerConfig {
+    /// Agents stepped per worker task when fanning out a tick.
+    pub batch_size: usize,
+    /// Maximum LLM escalations serviced per tick; the rest stay queued.
+    pub llm_budget_per_tick: usize,
+}
+
+impl Default for SchedulerConfig {
+    fn default() -> Self {
+        Self {
+            batch_size: 64,
+            llm_budget_per_tick: 4,
+        }
+    }
+}
+
+pub struct AgentScheduler {
+    agents: HashMap<String, Agent>,
+    // Situation signature at the agent's last escalation — only a change
+    // here justifies another LLM call
+    last_signature: HashMap<String, u64>,
+    escalation_queue: VecDeque<String>,
+    queued: HashSet<String>,
+    config: SchedulerConfig,
+}
+
+impl AgentScheduler {
+    pub fn new(config: SchedulerConfig) -> Self {
+        Self {
+            agents: HashMap::new(),
+            last_signature: HashMap::new(),
+            escalation_queue: VecDeque::new(),
+            queued: HashSet::new(),
+            config,
+        }
+    }
+
+    pub fn add_agent(&mut self, agent: Agent) {
+        self.agents.insert(agent.state().id.clone(), agent);
+    }
+
+    pub fn remove_agent(&mut self, id: &str) -> Option<Agent> {
+        self.last_signature.remove(id);
+        self.queued.remove(id);
+        self.agents.remove(id)
+    }
+
+    pub fn agent(&self, id: &str) -> Option<&Agent> {
+        self.agents.get(id)
+    }
+
+    pub fn len(&self) -> usize {
+        self.agents.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.agents.is_empty()
+    }
+
+    pub fn pending_escalations(&self) -> usize {
+        self.escalation_queue.len()
+    }
+
+    pub fn update_context(&mut self, id: &str, ctx: ReasoningContext) {
+        if let Some(agent) = self.agents.get_mut(id) {
+            agent.update_context(ctx);
+        }
+    }
+
+    /// One scheduler tick: reactive stepping for everyone, then a bounded
+    /// number of LLM escalations for agents whose situation changed.
+    pub async fn tick(&mut self) {
+        self.step_reactive_batches().await;
+        self.collect_escalations();
+        self.drain_escalations().await;
+    }
+
+    /// Fan the population out over the blocking pool in fixed-size
+    /// batches; the reactive path is pure CPU.
+    async fn step_reactive_batches(&mut self) {
+        let mut all: Vec<Agent> = self.agents.drain().map(|(_, agent)| agent).collect();
+        let mut workers = JoinSet::new();
+        while !all.is_empty() {
+            let take = self.config.batch_size.min(all.len());
+            let mut batch: Vec<Agent> = all.drain(..take).collect();
+            workers.spawn_blocking(move || {
+                for agent in &mut batch {
+                    // Isolate panics per agent: one bad planner input must
+                    // not take the rest of the batch down with it
+                    let step = std::panic::AssertUnwindSafe(|| agent.step_reactive());
+                    if std::panic::catch_unwind(step).is_err() {
+                        tracing::warn!("agent {} panicked during reactive step", agent.state().id);
+                    }
+                }
+                batch
+            });
+        }
+        while let Some(result) = workers.join_next().await {
+            match result {
+                Ok(batch) => {
+                    for agent in batch {
+                        self.agents.insert(agent.state().id.clone(), agent);
+                    }
+                }
+                // Only reachable on task cancellation; the agents moved
+                // into the task are gone, so make that loud
+                Err(e) => tracing::error!("reactive batch worker lost its agents: {}", e),
+            }
+        }
+    }
+
+    fn collect_escalations(&mut self) {
+        for (id, agent) in &self.agents {
+            let signature = situation_signature(&agent.state().context);
+            if self.last_signature.get(id) == Some(&signature) {
+                continue;
+            }
+            if self.queued.insert(id.clone()) {
+                self.escalation_queue.push_back(id.clone());
+            }
+        }
+    }
+
+    async fn drain_escalations(&mut self) {
+        let mut escalating = Vec::new();
+        while escalating.len() < self.config.llm_budget_per_tick {
+            let Some(id) = self.escalation_queue.pop_front() else {
+                break;
+            };
+            self.queued.remove(&id);
+            // The signature is recorded at escalation time, so an agent
+            // whose situation keeps drifting re-queues on a later tick
+            if let Some(agent) = self.agents.remove(&id) {
+                self.last_signature
+                    .insert(id, situation_signature(&agent.state().context));
+                escalating.push(agent);
+            }
+        }
+
+        let mut calls = JoinSet::new();
+        for mut agent in escalating {
+            calls.spawn(async move {
+                agent.escalate().await;
+                agent
+            });
+        }
+        while let Some(result) = calls.join_next().await {
+            match result {
+                Ok(agent) => {
+                    self.agents.insert(agent.state().id.clone(), agent);
+                }
+                // One agent per escalation task, so a panic costs exactly
+                // that agent — but never silently
+                Err(e) => tracing::warn!("agent escalation task failed: {}", e),
+            }
+        }
+    }
+}
+
+/// Coarse fingerprint of what an agent can currently perceive. Harmony
+/// and tension are quantized so ambient drift doesn't count as a
+/// material change.
+fn situation_signature(ctx: &ReasoningContext) -> u64 {
+    let mut hasher = std::collections::hash_map::DefaultHasher::new();
+    ctx.location.hash(&mut hasher);
+    ctx.nearby_entities.hash(&mut hasher);
+    ((ctx.harmony_level * 10.0) as i32).hash(&mut hasher);
+    ((ctx.tension * 10.0) as i32).hash(&mut hasher);
+    hasher.finish()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::llm_bridge::{LLMBridge, LLMEngine};
+    use ai_orchestra::{GenerationRequest, GenerationResponse};
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::sync::Arc;
+
+    struct CountingLLM(AtomicUsize);
+    #[async_trait::async_trait]
+    impl LLMEngine for CountingLLM {
+        async fn generate(
+            &self,
+            _request: GenerationRequest,
+        ) -> Result<GenerationResponse, Box<dyn std::error::Error + Send + Sync>> {
+            self.0.fetch_add(1, Ordering::SeqCst);
+            Ok(GenerationResponse {
+                text: "ok".into(),
+                model_used: "mock".into(),
+                tokens_used: 1,
+            })
+        }
+    }
+
+    fn agent_with_engine(id: &str, engine: Arc<dyn LLMEngine>) -> Agent {
+        let mut agent = Agent::new(id.into(), "r".into());
+        agent.set_bridge(LLMBridge::with_engine(engine));
+        agent
+    }
+
+    #[tokio::test]
+    async fn test_tick_respects_llm_budget() {
+        let engine = Arc::new(CountingLLM(AtomicUsize::new(0)));
+        let mut scheduler = AgentScheduler::new(SchedulerConfig {
+            batch_size: 4,
+            llm_budget_per_tick: 2,
+        });
+        for i in 0..10 {
+            scheduler.add_agent(agent_with_engine(&format!("npc-{}", i), engine.clone()));
+        }
+
+        // Every agent is new, so all ten want an escalation — only the
+        // budget's worth get one per tick
+        scheduler.tick().await;
+        assert_eq!(engine.0.load(Ordering::SeqCst), 2);
+        assert_eq!(scheduler.pending_escalations(), 8);
+
+        scheduler.tick().await;
+        assert_eq!(engine.0.load(Ordering::SeqCst), 4);
+    }
+
+    #[tokio::test]
+    async fn test_unchanged_situation_stays_on_reactive_path() {
+        let engine = Arc::new(CountingLLM(AtomicUsize::new(0)));
+        let mut scheduler = AgentScheduler::new(SchedulerConfig {
+            batch_size: 4,
+            llm_budget_per_tick: 8,
+        });
+        scheduler.add_agent(agent_with_engine("npc-0", engine.clone()));
+
+        scheduler.tick().await;
+        assert_eq!(engine.0.load(Ordering::SeqCst), 1);
+
+        // Nothing changed: further ticks step the planner but never
+        // touch the LLM
+        scheduler.tick().await;
+        scheduler.tick().await;
+        assert_eq!(engine.0.load(Ordering::SeqCst), 1);
+        assert!(scheduler.agent("npc-0").unwrap().state().last_action.is_some());
+
+        // A material change re-escalates
+        scheduler.update_context(
+            "npc-0",
+            ReasoningContext {
+                location: "grotto".into(),
+                nearby_entities: vec![],
+                harmony_level: 0.1,
+                tension: 0.9,
+                memory: vec![],
+            },
+        );
+        scheduler.tick().await;
+        assert_eq!(engine.0.load(Ordering::SeqCst), 2);
+    }
+}
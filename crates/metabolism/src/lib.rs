@@ -38,22 +38,42 @@ impl MetabolismSimulator {
         }
     }
 
+    fn step_region(&self, region: &mut RegionState) {
+        region.harmony_level *= 1.0 - self.harmony_decay_rate;
+        if region.discord_level > 0.1 {
+            region.discord_level *= 1.0 + self.discord_spread_rate;
+            if region.discord_level > 0.8 {
+                region.terrain_type = TerrainType::Corrupted;
+            }
+        }
+        if region.discord_level > 0.5 && rand::random::<f64>() < 0.3 {
+            region.weather.weather_type = WeatherType::DissonanceStorm;
+        }
+    }
+
     pub async fn simulate_tick(&self) {
         let mut regions = self.regions.write().await;
         for (_, region) in regions.iter_mut() {
-            region.harmony_level *= 1.0 - self.harmony_decay_rate;
-            if region.discord_level > 0.1 {
-                region.discord_level *= 1.0 + self.discord_spread_rate;
-                if region.discord_level > 0.8 {
-                    region.terrain_type = TerrainType::Corrupted;
-                }
-            }
-            if region.discord_level > 0.5 && rand::random::<f64>() < 0.3 {
-                region.weather.weather_type = WeatherType::DissonanceStorm;
+            self.step_region(region);
+        }
+    }
+
+    /// Advance a single region by `ticks` steps. Used by schedulers that tick
+    /// regions at different rates and need to fast-forward a region that was
+    /// ticked less often (or not at all) while nobody was nearby.
+    pub async fn simulate_region_ticks(&self, id: &RegionId, ticks: u32) {
+        let mut regions = self.regions.write().await;
+        if let Some(region) = regions.get_mut(id) {
+            for _ in 0..ticks {
+                self.step_region(region);
             }
         }
     }
 
+    pub async fn region_ids(&self) -> Vec<RegionId> {
+        self.regions.read().await.keys().cloned().collect()
+    }
+
     pub async fn add_region(&self, region: RegionState) {
         self.regions.write().await.insert(region.id.clone(), region);
     }
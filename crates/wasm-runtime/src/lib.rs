@@ -1,6 +1,9 @@
 // crates/wasm-runtime/src/lib.rs
 // Runtime for loading and executing Wasm plugins safely
-use std::path::Path;
+use std::collections::HashMap;
+use std::hash::Hasher;
+use std::path::{Path, PathBuf};
+use std::sync::{Arc, Mutex};
 use anyhow::{Context, Result};
 use wasmtime::{Engine, Func, Instance, Linker, Module, Store, Caller, Memory};
 
@@ -13,61 +16,208 @@ pub struct EventContext {
     pub payload_len: usize,
 }
 
-pub struct WasmPlugin {
-    instance: Instance,
-    store: Store<()>,
-    call_on_event: Func,
+/// Shared plugin runtime: one wasmtime `Engine` for every plugin, an
+/// in-memory compiled-module cache, and an optional on-disk cache of
+/// serialized modules keyed by file content hash. Recompiling a behavior
+/// plugin costs hundreds of milliseconds; deserializing a cached one is
+/// nearly free, so plugin-heavy services restart fast.
+pub struct WasmRuntime {
+    engine: Engine,
+    cache_dir: Option<PathBuf>,
+    modules: Mutex<HashMap<u64, Module>>,
 }
 
-impl WasmPlugin {
-    /// Load a Wasm module from the given path and prepare it for execution
-    pub fn load(path: &Path) -> Result<Self> {
-        let engine = Engine::default();
-        let module = Module::from_file(&engine, path)
-            .with_context(|| format!("Failed to load module at {:?}", path))?;
-
-        let mut store = Store::new(&engine, ());
-        let mut linker = Linker::new(&engine);
-
-        // Basic host functions for plugins
-        linker.func_wrap("env", "log", |mut caller: Caller<'_, ()>, ptr: i32, len: i32| {
-            if let Some(memory) = caller.get_export("memory").and_then(|e| e.into_memory()) {
-                let mut buf = vec![0u8; len as usize];
-                if memory.read(&mut caller, ptr as usize, &mut buf).is_ok() {
-                    if let Ok(msg) = String::from_utf8(buf) {
-                        println!("[wasm] {}", msg);
-                    }
-                }
-            }
-        })?;
+impl WasmRuntime {
+    pub fn new() -> Self {
+        Self {
+            engine: Engine::default(),
+            cache_dir: None,
+            modules: Mutex::new(HashMap::new()),
+        }
+    }
 
-        linker.func_wrap("env", "read_u8", |mut caller: Caller<'_, ()>, ptr: i32| -> i32 {
-            if let Some(memory) = caller.get_export("memory").and_then(|e| e.into_memory()) {
-                let mut byte = [0u8];
-                if memory.read(&mut caller, ptr as usize, &mut byte).is_ok() {
-                    return byte[0] as i32;
-                }
+    /// Runtime with a persistent module cache under `dir`. Cached artifacts
+    /// are only ever written by this runtime; the directory must not be
+    /// writable by untrusted code since deserialization trusts its contents.
+    pub fn with_cache_dir(dir: impl Into<PathBuf>) -> Result<Self> {
+        let dir = dir.into();
+        std::fs::create_dir_all(&dir)
+            .with_context(|| format!("Failed to create module cache dir {:?}", dir))?;
+        Ok(Self {
+            engine: Engine::default(),
+            cache_dir: Some(dir),
+            modules: Mutex::new(HashMap::new()),
+        })
+    }
+
+    pub fn engine(&self) -> &Engine {
+        &self.engine
+    }
+
+    /// Get the compiled module for `path`, compiling at most once per file
+    /// content hash across the process (and across restarts when a cache
+    /// directory is configured).
+    pub fn load_module(&self, path: &Path) -> Result<Module> {
+        let bytes = std::fs::read(path)
+            .with_context(|| format!("Failed to read module at {:?}", path))?;
+        let hash = content_hash(&bytes);
+
+        if let Some(module) = self.modules.lock().unwrap().get(&hash) {
+            return Ok(module.clone());
+        }
+
+        let module = match self.load_precompiled(hash) {
+            Some(module) => module,
+            None => {
+                let module = Module::new(&self.engine, &bytes)
+                    .with_context(|| format!("Failed to compile module at {:?}", path))?;
+                self.store_precompiled(hash, &module);
+                module
             }
-            0
-        })?;
+        };
+
+        self.modules.lock().unwrap().insert(hash, module.clone());
+        Ok(module)
+    }
+
+    fn cache_path(&self, hash: u64) -> Option<PathBuf> {
+        self.cache_dir
+            .as_ref()
+            .map(|dir| dir.join(format!("{:016x}.cwasm", hash)))
+    }
 
-        linker.func_wrap("env", "write_u8", |mut caller: Caller<'_, ()>, ptr: i32, val: i32| {
-            if let Some(memory) = caller.get_export("memory").and_then(|e| e.into_memory()) {
-                let _ = memory.write(&mut caller, ptr as usize, &[val as u8]);
+    fn load_precompiled(&self, hash: u64) -> Option<Module> {
+        let path = self.cache_path(hash)?;
+        if !path.exists() {
+            return None;
+        }
+        // Safety: the cache directory only contains artifacts we serialized
+        // ourselves with this engine configuration
+        unsafe { Module::deserialize_file(&self.engine, &path).ok() }
+    }
+
+    fn store_precompiled(&self, hash: u64, module: &Module) {
+        if let Some(path) = self.cache_path(hash) {
+            if let Ok(bytes) = module.serialize() {
+                // Best effort: a failed cache write just means recompiling
+                // next startup
+                let _ = std::fs::write(&path, bytes);
             }
-        })?;
+        }
+    }
+
+    /// Instantiate a plugin from an already compiled module.
+    pub fn instantiate(&self, module: &Module) -> Result<WasmPlugin> {
+        let mut store = Store::new(&self.engine, ());
+        let linker = build_linker(&self.engine)?;
 
-        let instance = linker.instantiate(&mut store, &module)?;
+        let instance = linker.instantiate(&mut store, module)?;
         let call_on_event = instance
             .get_func(&mut store, "on_event")
             .context("Missing `on_event` function")?;
 
-        Ok(Self {
+        Ok(WasmPlugin {
             instance,
             store,
             call_on_event,
         })
     }
+}
+
+fn build_linker(engine: &Engine) -> Result<Linker<()>> {
+    let mut linker = Linker::new(engine);
+
+    // Basic host functions for plugins
+    linker.func_wrap("env", "log", |mut caller: Caller<'_, ()>, ptr: i32, len: i32| {
+        if let Some(memory) = caller.get_export("memory").and_then(|e| e.into_memory()) {
+            let mut buf = vec![0u8; len as usize];
+            if memory.read(&mut caller, ptr as usize, &mut buf).is_ok() {
+                if let Ok(msg) = String::from_utf8(buf) {
+                    println!("[wasm] {}", msg);
+                }
+            }
+        }
+    })?;
+
+    linker.func_wrap("env", "read_u8", |mut caller: Caller<'_, ()>, ptr: i32| -> i32 {
+        if let Some(memory) = caller.get_export("memory").and_then(|e| e.into_memory()) {
+            let mut byte = [0u8];
+            if memory.read(&mut caller, ptr as usize, &mut byte).is_ok() {
+                return byte[0] as i32;
+            }
+        }
+        0
+    })?;
+
+    linker.func_wrap("env", "write_u8", |mut caller: Caller<'_, ()>, ptr: i32, val: i32| {
+        if let Some(memory) = caller.get_export("memory").and_then(|e| e.into_memory()) {
+            let _ = memory.write(&mut caller, ptr as usize, &[val as u8]);
+        }
+    })?;
+
+    Ok(linker)
+}
+
+fn content_hash(bytes: &[u8]) -> u64 {
+    let mut hasher = std::collections::hash_map::DefaultHasher::new();
+    hasher.write(bytes);
+    hasher.finish()
+}
+
+/// Pool of warm plugin instances sharing one compiled module. Dispatch grabs
+/// an idle instance (instantiating only when the pool is empty) and returns
+/// it afterwards, so steady-state event dispatch never pays instantiation.
+pub struct PluginPool {
+    runtime: Arc<WasmRuntime>,
+    module: Module,
+    idle: Mutex<Vec<WasmPlugin>>,
+}
+
+impl PluginPool {
+    /// Build a pool for the plugin at `path`, pre-instantiating `warm`
+    /// instances up front.
+    pub fn new(runtime: Arc<WasmRuntime>, path: &Path, warm: usize) -> Result<Self> {
+        let module = runtime.load_module(path)?;
+        let mut idle = Vec::with_capacity(warm);
+        for _ in 0..warm {
+            idle.push(runtime.instantiate(&module)?);
+        }
+        Ok(Self {
+            runtime,
+            module,
+            idle: Mutex::new(idle),
+        })
+    }
+
+    /// Dispatch an event on a warm instance.
+    pub fn call_on_event(&self, ctx: &EventContext) -> Result<()> {
+        let mut plugin = match self.idle.lock().unwrap().pop() {
+            Some(plugin) => plugin,
+            None => self.runtime.instantiate(&self.module)?,
+        };
+        let result = plugin.call_on_event(ctx);
+        self.idle.lock().unwrap().push(plugin);
+        result
+    }
+}
+
+pub struct WasmPlugin {
+    instance: Instance,
+    store: Store<()>,
+    call_on_event: Func,
+}
+
+impl WasmPlugin {
+    /// Load a Wasm module from the given path and prepare it for execution.
+    ///
+    /// Convenience for one-off loads; services loading several plugins (or
+    /// restarting often) should share a `WasmRuntime` so compilation is
+    /// cached.
+    pub fn load(path: &Path) -> Result<Self> {
+        let runtime = WasmRuntime::new();
+        let module = runtime.load_module(path)?;
+        runtime.instantiate(&module)
+    }
 
     /// Invoke the plugin's `on_event` function with the given `EventContext`
     pub fn call_on_event(&mut self, ctx: &EventContext) -> Result<()> {
@@ -23,6 +23,9 @@ pub enum MeshFormat {
     GLTF,
     OBJ,
     FBX,
+    /// Compact binary format (`mesh_format` module) — contiguous
+    /// vertex/index buffers loadable with a single read.
+    FVM,
 }
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -0,0 +1,307 @@
+// crates/world3d/src/entity_store.rs
+// Structure-of-arrays entity storage for grids.
+//
+// Hot per-tick data (positions, velocities, type tags) lives in dense
+// parallel arrays so interest checks walk contiguous memory instead of
+// scattered HashMap nodes. A stable id -> index map keeps lookups O(1)
+// across swap-removes, and per-field dirty bitsets let network snapshots
+// serialize only the entities that actually changed since the last tick.
+use crate::{EntityId, Position3D, entities::Entity};
+use serde::{Deserialize, Serialize};
+use std::collections::HashMap;
+
+/// Cheap type tag kept in its own array so filtering by kind never touches
+/// the fat `Entity` payload.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
+pub enum EntityKind {
+    Player,
+    NPC,
+    Echo,
+    Interactive,
+    Creature,
+}
+
+impl From<&Entity> for EntityKind {
+    fn from(entity: &Entity) -> Self {
+        match entity {
+            Entity::Player(_) => EntityKind::Player,
+            Entity::NPC(_) => EntityKind::NPC,
+            Entity::Echo(_) => EntityKind::Echo,
+            Entity::Interactive(_) => EntityKind::Interactive,
+            Entity::Creature(_) => EntityKind::Creature,
+        }
+    }
+}
+
+/// Dense bitset with one bit per entity slot.
+#[derive(Clone, Default, Serialize, Deserialize)]
+struct DirtyBits {
+    words: Vec<u64>,
+}
+
+impl DirtyBits {
+    fn set(&mut self, index: usize) {
+        let word = index / 64;
+        if word >= self.words.len() {
+            self.words.resize(word + 1, 0);
+        }
+        self.words[word] |= 1 << (index % 64);
+    }
+
+    fn get(&self, index: usize) -> bool {
+        self.words
+            .get(index / 64)
+            .map_or(false, |w| w & (1 << (index % 64)) != 0)
+    }
+
+    fn clear(&mut self) {
+        self.words.iter_mut().for_each(|w| *w = 0);
+    }
+
+    /// Move the bit at `from` to `to` (used when a swap-remove relocates the
+    /// last entity).
+    fn relocate(&mut self, from: usize, to: usize) {
+        let was_set = self.get(from);
+        if let Some(w) = self.words.get_mut(from / 64) {
+            *w &= !(1 << (from % 64));
+        }
+        if was_set {
+            self.set(to);
+        } else if let Some(w) = self.words.get_mut(to / 64) {
+            *w &= !(1 << (to % 64));
+        }
+    }
+}
+
+/// Minimal per-entity delta shipped in network snapshots.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct EntityDelta {
+    pub id: EntityId,
+    pub kind: EntityKind,
+    pub position: Position3D,
+    pub velocity: Position3D,
+}
+
+#[derive(Clone, Default, Serialize, Deserialize)]
+pub struct EntityStore {
+    ids: Vec<EntityId>,
+    positions: Vec<Position3D>,
+    velocities: Vec<Position3D>,
+    kinds: Vec<EntityKind>,
+    /// Full payloads, parallel to the hot arrays. Cold data: only touched
+    /// on lookup by id, never during position iteration.
+    payloads: Vec<Entity>,
+    index_of: HashMap<EntityId, usize>,
+    dirty_positions: DirtyBits,
+    dirty_payloads: DirtyBits,
+}
+
+impl EntityStore {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn insert(&mut self, entity: Entity) {
+        let id = entity.get_id();
+        if let Some(&index) = self.index_of.get(&id) {
+            self.positions[index] = entity.get_position();
+            self.kinds[index] = EntityKind::from(&entity);
+            self.payloads[index] = entity;
+            self.dirty_positions.set(index);
+            self.dirty_payloads.set(index);
+            return;
+        }
+
+        let index = self.ids.len();
+        self.ids.push(id);
+        self.positions.push(entity.get_position());
+        self.velocities.push(Position3D::new(0.0, 0.0, 0.0));
+        self.kinds.push(EntityKind::from(&entity));
+        self.payloads.push(entity);
+        self.index_of.insert(id, index);
+        self.dirty_positions.set(index);
+        self.dirty_payloads.set(index);
+    }
+
+    pub fn remove(&mut self, id: EntityId) -> Option<Entity> {
+        let index = self.index_of.remove(&id)?;
+        let last = self.ids.len() - 1;
+
+        self.ids.swap_remove(index);
+        self.positions.swap_remove(index);
+        self.velocities.swap_remove(index);
+        self.kinds.swap_remove(index);
+        let entity = self.payloads.swap_remove(index);
+
+        if index != last {
+            // The former last entity now lives at `index`
+            self.index_of.insert(self.ids[index], index);
+            self.dirty_positions.relocate(last, index);
+            self.dirty_payloads.relocate(last, index);
+        }
+        Some(entity)
+    }
+
+    pub fn get(&self, id: EntityId) -> Option<&Entity> {
+        self.index_of.get(&id).map(|&i| &self.payloads[i])
+    }
+
+    pub fn contains(&self, id: EntityId) -> bool {
+        self.index_of.contains_key(&id)
+    }
+
+    pub fn position_of(&self, id: EntityId) -> Option<Position3D> {
+        self.index_of.get(&id).map(|&i| self.positions[i])
+    }
+
+    pub fn set_position(&mut self, id: EntityId, position: Position3D) {
+        if let Some(&index) = self.index_of.get(&id) {
+            self.positions[index] = position;
+            self.dirty_positions.set(index);
+        }
+    }
+
+    pub fn set_velocity(&mut self, id: EntityId, velocity: Position3D) {
+        if let Some(&index) = self.index_of.get(&id) {
+            self.velocities[index] = velocity;
+            self.dirty_positions.set(index);
+        }
+    }
+
+    /// Mutate the full payload; marks the entity for full re-send.
+    pub fn update<F: FnOnce(&mut Entity)>(&mut self, id: EntityId, f: F) {
+        if let Some(&index) = self.index_of.get(&id) {
+            f(&mut self.payloads[index]);
+            self.positions[index] = self.payloads[index].get_position();
+            self.dirty_positions.set(index);
+            self.dirty_payloads.set(index);
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.ids.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.ids.is_empty()
+    }
+
+    /// Dense hot arrays for tick loops (interest checks, broadphase).
+    pub fn ids(&self) -> &[EntityId] {
+        &self.ids
+    }
+
+    pub fn positions(&self) -> &[Position3D] {
+        &self.positions
+    }
+
+    pub fn velocities(&self) -> &[Position3D] {
+        &self.velocities
+    }
+
+    pub fn kinds(&self) -> &[EntityKind] {
+        &self.kinds
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = (&EntityId, &Entity)> {
+        self.ids.iter().zip(self.payloads.iter())
+    }
+
+    /// Ids within `radius` of `center` — a linear pass over the dense
+    /// position array.
+    pub fn ids_in_radius(&self, center: Position3D, radius: f32) -> Vec<EntityId> {
+        self.positions
+            .iter()
+            .enumerate()
+            .filter(|(_, p)| p.distance_to(&center) <= radius)
+            .map(|(i, _)| self.ids[i])
+            .collect()
+    }
+
+    /// Deltas for every entity whose position or velocity changed since the
+    /// last call, then clears the position dirty bits.
+    pub fn drain_position_deltas(&mut self) -> Vec<EntityDelta> {
+        let deltas = self
+            .ids
+            .iter()
+            .enumerate()
+            .filter(|(i, _)| self.dirty_positions.get(*i))
+            .map(|(i, &id)| EntityDelta {
+                id,
+                kind: self.kinds[i],
+                position: self.positions[i],
+                velocity: self.velocities[i],
+            })
+            .collect();
+        self.dirty_positions.clear();
+        deltas
+    }
+
+    /// Full payloads for entities mutated through `insert`/`update` since
+    /// the last call, then clears the payload dirty bits.
+    pub fn drain_changed_entities(&mut self) -> Vec<Entity> {
+        let changed = self
+            .payloads
+            .iter()
+            .enumerate()
+            .filter(|(i, _)| self.dirty_payloads.get(*i))
+            .map(|(_, e)| e.clone())
+            .collect();
+        self.dirty_payloads.clear();
+        changed
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::entities::{PlayerEntity, ResonanceScore};
+    use uuid::Uuid;
+
+    fn player_at(x: f32) -> Entity {
+        Entity::Player(PlayerEntity {
+            id: EntityId(Uuid::new_v4()),
+            name: "test".to_string(),
+            position: Position3D::new(x, 0.0, 0.0),
+            resonance: ResonanceScore::default(),
+        })
+    }
+
+    #[test]
+    fn test_swap_remove_keeps_index_map_stable() {
+        let mut store = EntityStore::new();
+        let a = player_at(1.0);
+        let b = player_at(2.0);
+        let c = player_at(3.0);
+        let (a_id, b_id, c_id) = (a.get_id(), b.get_id(), c.get_id());
+        store.insert(a);
+        store.insert(b);
+        store.insert(c);
+
+        store.remove(b_id);
+        assert_eq!(store.len(), 2);
+        assert_eq!(store.position_of(a_id).unwrap().x, 1.0);
+        assert_eq!(store.position_of(c_id).unwrap().x, 3.0);
+        assert!(store.position_of(b_id).is_none());
+    }
+
+    #[test]
+    fn test_position_deltas_only_include_changes() {
+        let mut store = EntityStore::new();
+        let a = player_at(1.0);
+        let b = player_at(2.0);
+        let a_id = a.get_id();
+        store.insert(a);
+        store.insert(b);
+
+        // Inserts are dirty until drained once
+        assert_eq!(store.drain_position_deltas().len(), 2);
+        assert!(store.drain_position_deltas().is_empty());
+
+        store.set_position(a_id, Position3D::new(5.0, 0.0, 0.0));
+        let deltas = store.drain_position_deltas();
+        assert_eq!(deltas.len(), 1);
+        assert_eq!(deltas[0].id, a_id);
+        assert_eq!(deltas[0].position.x, 5.0);
+    }
+}
@@ -3,6 +3,7 @@ use crate::{
     GridCoordinate, EntityId, Position3D,
     terrain::TerrainPatch,
     entities::Entity,
+    entity_store::EntityStore,
 };
 use std::collections::{HashMap, HashSet};
 use serde::{Deserialize, Serialize};
@@ -11,7 +12,9 @@ use serde::{Deserialize, Serialize};
 pub struct Grid {
     pub coordinate: GridCoordinate,
     pub terrain: TerrainPatch,
-    pub entities: HashMap<EntityId, Entity>,
+    // Active entities in SoA form: dense position/velocity/kind arrays for
+    // tick loops, dirty bits for delta snapshots
+    pub entities: EntityStore,
     pub inactive_entities: HashMap<EntityId, Entity>, // Entities waiting to be triggered
     pub structures: Vec<Structure>,
     pub ambient_effects: Vec<AmbientEffect>,
@@ -37,7 +40,7 @@ impl Grid {
         Self {
             coordinate,
             terrain,
-            entities: HashMap::new(),
+            entities: EntityStore::new(),
             inactive_entities: HashMap::new(),
             structures: Vec::new(),
             ambient_effects: Vec::new(),
@@ -45,8 +48,7 @@ impl Grid {
     }
 
     pub fn add_entity(&mut self, entity: Entity) {
-        let id = entity.get_id();
-        self.entities.insert(id, entity);
+        self.entities.insert(entity);
     }
 
     pub fn add_entity_inactive(&mut self, entity: Entity) {
@@ -56,7 +58,7 @@ impl Grid {
 
     pub fn activate_entity(&mut self, entity_id: EntityId) -> Option<Entity> {
         if let Some(entity) = self.inactive_entities.remove(&entity_id) {
-            self.entities.insert(entity_id, entity.clone());
+            self.entities.insert(entity.clone());
             Some(entity)
         } else {
             None
@@ -3,12 +3,16 @@ pub mod world;
 pub mod region;
 pub mod grid;
 pub mod terrain;
+pub mod terrain_streaming;
 pub mod entities;
+pub mod entity_store;
+pub mod snapshot;
 pub mod spatial;
 pub mod interactive_objects;
 pub mod echo_entities;
 pub mod assets;
-mod terrain_generator;
+pub mod mesh_format;
+pub mod terrain_generator;
 
 use serde::{Deserialize, Serialize};
 use nalgebra::{Vector3, Point3};
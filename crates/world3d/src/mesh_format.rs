@@ -0,0 +1,131 @@
+// crates/world3d/src/mesh_format.rs
+// Compact binary mesh format (.fvm). A 16-byte header followed by two
+// contiguous little-endian buffers — interleaved vertices (position,
+// normal, uv; 32 bytes each) then u32 indices — so a client can read the
+// file once and hand both buffers to the GPU without parsing:
+//
+//   offset 0   magic   b"FVM1"
+//   offset 4   u32     version (currently 1)
+//   offset 8   u32     vertex count
+//   offset 12  u32     index count
+//   offset 16  vertex buffer, then index buffer
+use serde::{Deserialize, Serialize};
+use std::io;
+
+const MAGIC: &[u8; 4] = b"FVM1";
+const VERSION: u32 = 1;
+const HEADER_LEN: usize = 16;
+pub const VERTEX_STRIDE: usize = 32;
+
+#[derive(Debug, Clone, Copy, PartialEq, Serialize, Deserialize)]
+#[repr(C)]
+pub struct MeshVertex {
+    pub position: [f32; 3],
+    pub normal: [f32; 3],
+    pub uv: [f32; 2],
+}
+
+#[derive(Debug, Clone, Default, PartialEq)]
+pub struct MeshData {
+    pub vertices: Vec<MeshVertex>,
+    pub indices: Vec<u32>,
+}
+
+impl MeshData {
+    pub fn encode(&self) -> Vec<u8> {
+        let mut out = Vec::with_capacity(
+            HEADER_LEN + self.vertices.len() * VERTEX_STRIDE + self.indices.len() * 4,
+        );
+        out.extend_from_slice(MAGIC);
+        out.extend_from_slice(&VERSION.to_le_bytes());
+        out.extend_from_slice(&(self.vertices.len() as u32).to_le_bytes());
+        out.extend_from_slice(&(self.indices.len() as u32).to_le_bytes());
+
+        for v in &self.vertices {
+            for f in v.position.iter().chain(&v.normal).chain(&v.uv) {
+                out.extend_from_slice(&f.to_le_bytes());
+            }
+        }
+        for i in &self.indices {
+            out.extend_from_slice(&i.to_le_bytes());
+        }
+        out
+    }
+
+    pub fn decode(bytes: &[u8]) -> io::Result<Self> {
+        if bytes.len() < HEADER_LEN {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "truncated mesh header"));
+        }
+        if &bytes[0..4] != MAGIC {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "not an FVM mesh"));
+        }
+        let version = u32::from_le_bytes(bytes[4..8].try_into().unwrap());
+        if version != VERSION {
+            return Err(io::Error::new(
+                io::ErrorKind::InvalidData,
+                format!("unsupported FVM version {}", version),
+            ));
+        }
+        let vertex_count = u32::from_le_bytes(bytes[8..12].try_into().unwrap()) as usize;
+        let index_count = u32::from_le_bytes(bytes[12..16].try_into().unwrap()) as usize;
+
+        let needed = HEADER_LEN + vertex_count * VERTEX_STRIDE + index_count * 4;
+        if bytes.len() < needed {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "truncated mesh data"));
+        }
+
+        let mut vertices = Vec::with_capacity(vertex_count);
+        let mut at = HEADER_LEN;
+        let read_f32 = |at: &mut usize| {
+            let v = f32::from_le_bytes(bytes[*at..*at + 4].try_into().unwrap());
+            *at += 4;
+            v
+        };
+        for _ in 0..vertex_count {
+            vertices.push(MeshVertex {
+                position: [read_f32(&mut at), read_f32(&mut at), read_f32(&mut at)],
+                normal: [read_f32(&mut at), read_f32(&mut at), read_f32(&mut at)],
+                uv: [read_f32(&mut at), read_f32(&mut at)],
+            });
+        }
+
+        let mut indices = Vec::with_capacity(index_count);
+        for _ in 0..index_count {
+            indices.push(u32::from_le_bytes(bytes[at..at + 4].try_into().unwrap()));
+            at += 4;
+        }
+
+        Ok(Self { vertices, indices })
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_mesh_roundtrip() {
+        let mesh = MeshData {
+            vertices: vec![
+                MeshVertex {
+                    position: [0.0, 1.0, 2.0],
+                    normal: [0.0, 1.0, 0.0],
+                    uv: [0.5, 0.5],
+                },
+                MeshVertex {
+                    position: [-1.5, 0.25, 3.0],
+                    normal: [0.707, 0.0, 0.707],
+                    uv: [0.0, 1.0],
+                },
+            ],
+            indices: vec![0, 1, 0],
+        };
+
+        let bytes = mesh.encode();
+        assert_eq!(bytes.len(), 16 + 2 * VERTEX_STRIDE + 3 * 4);
+        assert_eq!(MeshData::decode(&bytes).unwrap(), mesh);
+
+        assert!(MeshData::decode(&bytes[..20]).is_err());
+        assert!(MeshData::decode(b"NOPE").is_err());
+    }
+}
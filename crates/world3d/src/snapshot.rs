@@ -0,0 +1,333 @@
+// crates/world3d/src/snapshot.rs
+// Memory-mapped snapshot format for grid persistence.
+//
+// Serde walks and allocates the whole Grid on both ends, so restart time
+// grows with explored world size. Snapshots instead write each grid with a
+// fixed-layout terrain section: a restarted world-engine maps the file and
+// serves heights straight out of the mapping without parsing anything.
+// Entity state sits in a trailing section that is deserialized lazily the
+// first time something actually asks for it.
+//
+// Layout (all integers little-endian):
+//   [0..64)   header: magic "FVGS", version, grid coordinate, resolution,
+//             offsets/lengths of the cold and entity sections
+//   [64..)    terrain: resolution^2 f32 heights, row-major (y * res + x)
+//   cold      bincode: textures, vegetation, water, structures, effects
+//   entities  bincode: active EntityStore + inactive entity map
+use crate::{
+    GridCoordinate, EntityId,
+    entities::Entity,
+    entity_store::EntityStore,
+    grid::{AmbientEffect, Grid, Structure},
+    terrain::{TerrainLayer, TerrainPatch, VegetationMap, WaterBody},
+};
+use memmap2::Mmap;
+use serde::{Deserialize, Serialize};
+use std::collections::HashMap;
+use std::fs::File;
+use std::io::{self, Write};
+use std::path::{Path, PathBuf};
+use std::sync::OnceLock;
+
+const MAGIC: &[u8; 4] = b"FVGS";
+const VERSION: u32 = 1;
+const HEADER_LEN: usize = 64;
+
+/// Everything in a Grid that is not hot terrain or entity state.
+#[derive(Serialize, Deserialize)]
+struct ColdSection {
+    textures: Vec<TerrainLayer>,
+    vegetation_map: VegetationMap,
+    water_bodies: Vec<WaterBody>,
+    structures: Vec<Structure>,
+    ambient_effects: Vec<AmbientEffect>,
+}
+
+#[derive(Serialize, Deserialize)]
+struct EntitySection {
+    entities: EntityStore,
+    inactive_entities: HashMap<EntityId, Entity>,
+}
+
+/// File name of one grid's snapshot inside a region directory.
+pub fn grid_snapshot_name(coordinate: GridCoordinate) -> String {
+    format!("grid_{}_{}.fvgs", coordinate.x, coordinate.y)
+}
+
+/// Write a grid snapshot into `dir`, returning the file path. The write is
+/// atomic: data lands in a temp file that is renamed over the target.
+pub fn write_grid_snapshot(dir: &Path, grid: &Grid) -> io::Result<PathBuf> {
+    std::fs::create_dir_all(dir)?;
+    let path = dir.join(grid_snapshot_name(grid.coordinate));
+    let tmp_path = path.with_extension("fvgs.tmp");
+
+    let resolution = grid.terrain.heightmap.len();
+    let terrain_len = resolution * resolution * 4;
+
+    let cold = bincode::serialize(&ColdSection {
+        textures: grid.terrain.textures.clone(),
+        vegetation_map: grid.terrain.vegetation_map.clone(),
+        water_bodies: grid.terrain.water_bodies.clone(),
+        structures: grid.structures.clone(),
+        ambient_effects: grid.ambient_effects.clone(),
+    })
+    .map_err(|e| io::Error::new(io::ErrorKind::InvalidData, e))?;
+
+    let entities = bincode::serialize(&EntitySection {
+        entities: grid.entities.clone(),
+        inactive_entities: grid.inactive_entities.clone(),
+    })
+    .map_err(|e| io::Error::new(io::ErrorKind::InvalidData, e))?;
+
+    let cold_off = (HEADER_LEN + terrain_len) as u64;
+    let entities_off = cold_off + cold.len() as u64;
+
+    let mut header = [0u8; HEADER_LEN];
+    header[0..4].copy_from_slice(MAGIC);
+    header[4..8].copy_from_slice(&VERSION.to_le_bytes());
+    header[8..12].copy_from_slice(&grid.coordinate.x.to_le_bytes());
+    header[12..16].copy_from_slice(&grid.coordinate.y.to_le_bytes());
+    header[16..20].copy_from_slice(&(resolution as u32).to_le_bytes());
+    header[20..28].copy_from_slice(&cold_off.to_le_bytes());
+    header[28..36].copy_from_slice(&(cold.len() as u64).to_le_bytes());
+    header[36..44].copy_from_slice(&entities_off.to_le_bytes());
+    header[44..52].copy_from_slice(&(entities.len() as u64).to_le_bytes());
+
+    let mut file = File::create(&tmp_path)?;
+    file.write_all(&header)?;
+    // Row-major so MappedGrid::height() is a single multiply-add
+    let mut row_buf = Vec::with_capacity(resolution * 4);
+    for y in 0..resolution {
+        row_buf.clear();
+        for x in 0..resolution {
+            row_buf.extend_from_slice(&grid.terrain.heightmap[y][x].to_le_bytes());
+        }
+        file.write_all(&row_buf)?;
+    }
+    file.write_all(&cold)?;
+    file.write_all(&entities)?;
+    file.sync_all()?;
+    std::fs::rename(&tmp_path, &path)?;
+
+    Ok(path)
+}
+
+/// Write every grid of a region under `dir/<region dir name>`.
+pub fn write_region_snapshot(
+    dir: &Path,
+    region: &crate::region::Region,
+) -> io::Result<PathBuf> {
+    let region_dir = dir.join(format!("region_{}", region.id.0));
+    for grid in region.grids.values() {
+        write_grid_snapshot(&region_dir, grid)?;
+    }
+    Ok(region_dir)
+}
+
+/// A grid served directly out of a mapped snapshot file. Terrain reads
+/// never parse or allocate; entity state is deserialized on first access.
+pub struct MappedGrid {
+    mmap: Mmap,
+    coordinate: GridCoordinate,
+    resolution: usize,
+    cold_range: (usize, usize),
+    entity_range: (usize, usize),
+    entities: OnceLock<EntitySection>,
+}
+
+impl MappedGrid {
+    pub fn open(path: &Path) -> io::Result<Self> {
+        let file = File::open(path)?;
+        // Safety: snapshots are written atomically and never mutated after
+        // the rename, so the mapping stays consistent
+        let mmap = unsafe { Mmap::map(&file)? };
+
+        if mmap.len() < HEADER_LEN || &mmap[0..4] != MAGIC {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "not a grid snapshot"));
+        }
+        let version = u32::from_le_bytes(mmap[4..8].try_into().unwrap());
+        if version != VERSION {
+            return Err(io::Error::new(
+                io::ErrorKind::InvalidData,
+                format!("unsupported snapshot version {}", version),
+            ));
+        }
+
+        let coordinate = GridCoordinate::new(
+            i32::from_le_bytes(mmap[8..12].try_into().unwrap()),
+            i32::from_le_bytes(mmap[12..16].try_into().unwrap()),
+        );
+        let resolution = u32::from_le_bytes(mmap[16..20].try_into().unwrap()) as usize;
+        let cold_off = u64::from_le_bytes(mmap[20..28].try_into().unwrap()) as usize;
+        let cold_len = u64::from_le_bytes(mmap[28..36].try_into().unwrap()) as usize;
+        let entities_off = u64::from_le_bytes(mmap[36..44].try_into().unwrap()) as usize;
+        let entities_len = u64::from_le_bytes(mmap[44..52].try_into().unwrap()) as usize;
+
+        let end = entities_off.checked_add(entities_len);
+        if end.map_or(true, |e| e > mmap.len()) {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "truncated grid snapshot"));
+        }
+
+        Ok(Self {
+            mmap,
+            coordinate,
+            resolution,
+            cold_range: (cold_off, cold_off + cold_len),
+            entity_range: (entities_off, entities_off + entities_len),
+            entities: OnceLock::new(),
+        })
+    }
+
+    pub fn coordinate(&self) -> GridCoordinate {
+        self.coordinate
+    }
+
+    pub fn resolution(&self) -> usize {
+        self.resolution
+    }
+
+    /// Height at (x, y), read straight from the mapping.
+    pub fn height(&self, x: usize, y: usize) -> f32 {
+        let offset = HEADER_LEN + (y * self.resolution + x) * 4;
+        f32::from_le_bytes(self.mmap[offset..offset + 4].try_into().unwrap())
+    }
+
+    /// The raw little-endian terrain section, e.g. for streaming a grid to
+    /// a client without touching individual samples.
+    pub fn terrain_bytes(&self) -> &[u8] {
+        &self.mmap[HEADER_LEN..HEADER_LEN + self.resolution * self.resolution * 4]
+    }
+
+    fn entity_section(&self) -> &EntitySection {
+        self.entities.get_or_init(|| {
+            let (start, end) = self.entity_range;
+            bincode::deserialize(&self.mmap[start..end]).unwrap_or_else(|_| EntitySection {
+                entities: EntityStore::new(),
+                inactive_entities: HashMap::new(),
+            })
+        })
+    }
+
+    /// Active entities, deserialized on first call and cached.
+    pub fn entities(&self) -> &EntityStore {
+        &self.entity_section().entities
+    }
+
+    /// Whether the entity section has been deserialized yet.
+    pub fn entities_loaded(&self) -> bool {
+        self.entities.get().is_some()
+    }
+
+    /// Materialize a full in-memory Grid (the slow path — only needed when
+    /// the grid is about to be mutated).
+    pub fn to_grid(&self) -> io::Result<Grid> {
+        let (start, end) = self.cold_range;
+        let cold: ColdSection = bincode::deserialize(&self.mmap[start..end])
+            .map_err(|e| io::Error::new(io::ErrorKind::InvalidData, e))?;
+
+        let mut heightmap = vec![vec![0.0f32; self.resolution]; self.resolution];
+        for y in 0..self.resolution {
+            for x in 0..self.resolution {
+                heightmap[y][x] = self.height(x, y);
+            }
+        }
+
+        let section = self.entity_section();
+        let mut grid = Grid::new(
+            self.coordinate,
+            TerrainPatch {
+                heightmap,
+                textures: cold.textures,
+                vegetation_map: cold.vegetation_map,
+                water_bodies: cold.water_bodies,
+            },
+        );
+        grid.structures = cold.structures;
+        grid.ambient_effects = cold.ambient_effects;
+        grid.entities = section.entities.clone();
+        grid.inactive_entities = section.inactive_entities.clone();
+        Ok(grid)
+    }
+}
+
+/// All grid snapshots of a region directory, mapped but not parsed.
+pub struct MappedRegion {
+    pub grids: HashMap<GridCoordinate, MappedGrid>,
+}
+
+impl MappedRegion {
+    /// Map every snapshot in the directory. Cost is proportional to the
+    /// number of files, not their size — nothing is read eagerly.
+    pub fn open(region_dir: &Path) -> io::Result<Self> {
+        let mut grids = HashMap::new();
+        for entry in std::fs::read_dir(region_dir)? {
+            let path = entry?.path();
+            if path.extension().map_or(false, |e| e == "fvgs") {
+                let grid = MappedGrid::open(&path)?;
+                grids.insert(grid.coordinate(), grid);
+            }
+        }
+        Ok(Self { grids })
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::entities::{PlayerEntity, ResonanceScore};
+    use crate::terrain::{Biome, TerrainGenerator};
+    use crate::Position3D;
+    use uuid::Uuid;
+
+    fn test_grid() -> Grid {
+        let generator = TerrainGenerator::new(7);
+        let terrain =
+            generator.generate_grid_terrain(GridCoordinate::new(2, -3), 0.6, Biome::Other);
+        let mut grid = Grid::new(GridCoordinate::new(2, -3), terrain);
+        grid.add_entity(Entity::Player(PlayerEntity {
+            id: EntityId(Uuid::new_v4()),
+            name: "snapshot-test".to_string(),
+            position: Position3D::new(10.0, 0.0, 20.0),
+            resonance: ResonanceScore::default(),
+        }));
+        grid.add_structure("shrine", Position3D::new(64.0, 12.0, 64.0));
+        grid
+    }
+
+    #[test]
+    fn test_snapshot_roundtrip() {
+        let dir = std::env::temp_dir().join(format!("fv_snap_{}", Uuid::new_v4()));
+        let grid = test_grid();
+
+        let path = write_grid_snapshot(&dir, &grid).unwrap();
+        let mapped = MappedGrid::open(&path).unwrap();
+
+        assert_eq!(mapped.coordinate(), grid.coordinate);
+        assert_eq!(mapped.resolution(), grid.terrain.heightmap.len());
+        assert_eq!(mapped.height(5, 9), grid.terrain.heightmap[9][5]);
+
+        let restored = mapped.to_grid().unwrap();
+        assert_eq!(restored.entities.len(), 1);
+        assert_eq!(restored.structures.len(), 1);
+        assert_eq!(restored.terrain.heightmap, grid.terrain.heightmap);
+
+        std::fs::remove_dir_all(&dir).unwrap();
+    }
+
+    #[test]
+    fn test_entities_load_lazily() {
+        let dir = std::env::temp_dir().join(format!("fv_snap_{}", Uuid::new_v4()));
+        let path = write_grid_snapshot(&dir, &test_grid()).unwrap();
+
+        let mapped = MappedGrid::open(&path).unwrap();
+        // Terrain access must not trigger entity deserialization
+        let _ = mapped.height(0, 0);
+        let _ = mapped.terrain_bytes();
+        assert!(!mapped.entities_loaded());
+
+        assert_eq!(mapped.entities().len(), 1);
+        assert!(mapped.entities_loaded());
+
+        std::fs::remove_dir_all(&dir).unwrap();
+    }
+}
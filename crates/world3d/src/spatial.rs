@@ -1,12 +1,152 @@
 use crate::{GridCoordinate, PlayerId};
-use std::collections::HashMap;
+use std::collections::{HashMap, HashSet};
 
+/// Spatial index over grid coordinates: players are bucketed into per-cell
+/// sets so interest queries ("who can see this grid?") cost O(cells in range)
+/// instead of a scan over every tracked player.
 pub struct SpatialTracker {
-    pub players: HashMap<PlayerId, GridCoordinate>,
+    players: HashMap<PlayerId, GridCoordinate>,
+    cells: HashMap<GridCoordinate, HashSet<PlayerId>>,
 }
 
 impl SpatialTracker {
     pub fn new() -> Self {
-        Self { players: HashMap::new() }
+        Self {
+            players: HashMap::new(),
+            cells: HashMap::new(),
+        }
+    }
+
+    /// Insert a player or move them to a new cell. Returns the previous cell
+    /// if the player was already tracked somewhere else.
+    pub fn update_player(&mut self, player: PlayerId, coord: GridCoordinate) -> Option<GridCoordinate> {
+        let previous = self.players.insert(player, coord);
+
+        if let Some(prev) = previous {
+            if prev == coord {
+                return previous;
+            }
+            self.remove_from_cell(&player, &prev);
+        }
+
+        self.cells.entry(coord).or_default().insert(player);
+        previous
+    }
+
+    /// Remove a player from the index entirely (disconnect).
+    pub fn remove_player(&mut self, player: &PlayerId) -> Option<GridCoordinate> {
+        let coord = self.players.remove(player)?;
+        self.remove_from_cell(player, &coord);
+        Some(coord)
+    }
+
+    /// Current cell of a tracked player.
+    pub fn position_of(&self, player: &PlayerId) -> Option<GridCoordinate> {
+        self.players.get(player).copied()
+    }
+
+    /// Players standing in exactly this cell.
+    pub fn players_in_cell(&self, coord: GridCoordinate) -> impl Iterator<Item = &PlayerId> {
+        self.cells.get(&coord).into_iter().flatten()
+    }
+
+    /// Players within `radius` cells (Chebyshev distance) of `center` — the
+    /// interest set for an entity in that cell.
+    pub fn players_in_radius(&self, center: GridCoordinate, radius: i32) -> Vec<PlayerId> {
+        self.players_in_aabb(
+            GridCoordinate::new(center.x - radius, center.y - radius),
+            GridCoordinate::new(center.x + radius, center.y + radius),
+        )
+    }
+
+    /// Players inside the inclusive axis-aligned box `[min, max]`. Only the
+    /// covered cells are visited, so sparse boxes are cheap.
+    pub fn players_in_aabb(&self, min: GridCoordinate, max: GridCoordinate) -> Vec<PlayerId> {
+        let mut result = Vec::new();
+        for x in min.x..=max.x {
+            for y in min.y..=max.y {
+                if let Some(cell) = self.cells.get(&GridCoordinate::new(x, y)) {
+                    result.extend(cell.iter().copied());
+                }
+            }
+        }
+        result
+    }
+
+    /// Cells that currently contain at least one player, with their
+    /// occupants. Useful for per-region tick scheduling.
+    pub fn occupied_cells(&self) -> impl Iterator<Item = (&GridCoordinate, &HashSet<PlayerId>)> {
+        self.cells.iter()
+    }
+
+    pub fn player_count(&self) -> usize {
+        self.players.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.players.is_empty()
+    }
+
+    fn remove_from_cell(&mut self, player: &PlayerId, coord: &GridCoordinate) {
+        if let Some(cell) = self.cells.get_mut(coord) {
+            cell.remove(player);
+            if cell.is_empty() {
+                self.cells.remove(coord);
+            }
+        }
+    }
+}
+
+impl Default for SpatialTracker {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use uuid::Uuid;
+
+    fn player() -> PlayerId {
+        PlayerId(Uuid::new_v4())
+    }
+
+    #[test]
+    fn update_moves_player_between_cells() {
+        let mut tracker = SpatialTracker::new();
+        let p = player();
+
+        tracker.update_player(p, GridCoordinate::new(0, 0));
+        tracker.update_player(p, GridCoordinate::new(1, 0));
+
+        assert_eq!(tracker.position_of(&p), Some(GridCoordinate::new(1, 0)));
+        assert_eq!(tracker.players_in_cell(GridCoordinate::new(0, 0)).count(), 0);
+        assert_eq!(tracker.players_in_cell(GridCoordinate::new(1, 0)).count(), 1);
+    }
+
+    #[test]
+    fn radius_query_only_returns_nearby_players() {
+        let mut tracker = SpatialTracker::new();
+        let near = player();
+        let far = player();
+
+        tracker.update_player(near, GridCoordinate::new(1, 1));
+        tracker.update_player(far, GridCoordinate::new(10, 10));
+
+        let visible = tracker.players_in_radius(GridCoordinate::new(0, 0), 2);
+        assert!(visible.contains(&near));
+        assert!(!visible.contains(&far));
+    }
+
+    #[test]
+    fn remove_clears_empty_cells() {
+        let mut tracker = SpatialTracker::new();
+        let p = player();
+
+        tracker.update_player(p, GridCoordinate::new(3, 3));
+        assert_eq!(tracker.remove_player(&p), Some(GridCoordinate::new(3, 3)));
+        assert!(tracker.is_empty());
+        assert_eq!(tracker.occupied_cells().count(), 0);
     }
 }
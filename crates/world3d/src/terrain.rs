@@ -295,7 +295,7 @@ impl TerrainGenerator {
     }
 }
 
-#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub enum Biome {
     WeaversLanding,
     WhisperwoodGrove,
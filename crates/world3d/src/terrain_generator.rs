@@ -1,8 +1,25 @@
 // crates/world-3d/src/terrain_generator.rs
 use noise::{NoiseFn, Perlin, Seedable, SuperSimplex, Fbm, MultiFractal};
 use nalgebra::{Vector2, Vector3};
+use rayon::prelude::*;
 use std::collections::HashMap;
 
+/// Heightmap resolution of a full-detail grid.
+pub const FULL_RESOLUTION: usize = 256;
+
+/// Coarsest mip level; see `lod_resolution`.
+pub const MAX_LOD: u32 = 3;
+
+/// Resolution of each mip level: 256 -> 128 -> 64 -> 16.
+pub fn lod_resolution(lod: u32) -> usize {
+    match lod {
+        0 => 256,
+        1 => 128,
+        2 => 64,
+        _ => 16,
+    }
+}
+
 pub struct TerrainGenerator {
     noise_engine: NoiseEngine,
     biome_mapper: BiomeMapper,
@@ -33,43 +50,110 @@ impl NoiseEngine {
     }
 
     pub fn generate_heightmap(&self, grid_coord: GridCoordinate) -> HeightMap {
-        let grid_size = 256;
-        let mut heights = vec![vec![0.0; grid_size]; grid_size];
+        self.generate_heightmap_lod(grid_coord, 0)
+    }
 
-        let base_x = grid_coord.x as f64 * grid_size as f64;
-        let base_z = grid_coord.z as f64 * grid_size as f64;
+    /// Generate a heightmap at the given LOD. Coarse levels sample fewer
+    /// points AND skip the high-frequency octaves (detail noise, erosion)
+    /// that would alias away at that resolution anyway, so a LOD 3 grid
+    /// costs roughly 1% of a full one to produce and store.
+    pub fn generate_heightmap_lod(&self, grid_coord: GridCoordinate, lod: u32) -> HeightMap {
+        let lod = lod.min(MAX_LOD);
+        let grid_size = lod_resolution(lod);
+        let stride = (FULL_RESOLUTION / grid_size) as f64;
+
+        let base_x = grid_coord.x as f64 * FULL_RESOLUTION as f64;
+        let base_z = grid_coord.z as f64 * FULL_RESOLUTION as f64;
+
+        // Flat row-major buffer: one allocation for the whole grid, filled
+        // row-by-row in parallel. Min/max fold happens during generation so
+        // we never re-scan the finished buffer.
+        let mut heights = vec![0.0f64; grid_size * grid_size];
+
+        let (min_height, max_height) = heights
+            .par_chunks_mut(grid_size)
+            .enumerate()
+            .map(|(x, row)| {
+                let world_x = base_x + x as f64 * stride;
+                let mut row_min = f64::INFINITY;
+                let mut row_max = f64::NEG_INFINITY;
+
+                for (z, cell) in row.iter_mut().enumerate() {
+                    let world_z = base_z + z as f64 * stride;
+
+                    let height = self.sample_height(world_x, world_z, lod);
+
+                    row_min = row_min.min(height);
+                    row_max = row_max.max(height);
+                    *cell = height;
+                }
 
-        for x in 0..grid_size {
-            for z in 0..grid_size {
-                let world_x = base_x + x as f64;
-                let world_z = base_z + z as f64;
+                (row_min, row_max)
+            })
+            .reduce(
+                || (f64::INFINITY, f64::NEG_INFINITY),
+                |(a_min, a_max), (b_min, b_max)| (a_min.min(b_min), a_max.max(b_max)),
+            );
 
-                // Multi-octave height generation
-                let mut height = 0.0;
+        HeightMap {
+            data: heights,
+            size: grid_size,
+            lod,
+            min_height,
+            max_height,
+        }
+    }
 
-                // Continental shelf
-                let continental = self.height_noise.get([world_x * 0.0001, world_z * 0.0001]) * 100.0;
+    /// Height at one world position, evaluating only the octaves visible at
+    /// the given LOD. The low-frequency continental octave always runs; the
+    /// regional octave stops mattering past half resolution and detail
+    /// noise plus erosion only survive at full resolution.
+    fn sample_height(&self, world_x: f64, world_z: f64, lod: u32) -> f64 {
+        // Multi-octave height generation
 
-                // Regional variations
-                let regional = self.height_noise.get([world_x * 0.001, world_z * 0.001]) * 30.0;
+        // Continental shelf
+        let continental = self.height_noise.get([world_x * 0.0001, world_z * 0.0001]) * 100.0;
 
-                // Local details
-                let detail = self.detail_noise.get([world_x * 0.01, world_z * 0.01]) * 5.0;
+        let mut height = continental + 50.0; // Base height at 50m
 
-                height = continental + regional + detail + 50.0; // Base height at 50m
+        if lod <= 1 {
+            // Regional variations
+            height += self.height_noise.get([world_x * 0.001, world_z * 0.001]) * 30.0;
+        }
 
-                // Apply erosion simulation
-                height = self.apply_erosion(height, world_x, world_z);
+        if lod == 0 {
+            // Local details
+            height += self.detail_noise.get([world_x * 0.01, world_z * 0.01]) * 5.0;
 
-                heights[x][z] = height;
-            }
+            // Apply erosion simulation
+            height = self.apply_erosion(height, world_x, world_z);
         }
 
-        HeightMap {
-            data: heights.clone(),
-            min_height: heights.iter().flatten().fold(f64::INFINITY, |a, &b| a.min(b)),
-            max_height: heights.iter().flatten().fold(f64::NEG_INFINITY, |a, &b| a.max(b)),
+        height
+    }
+
+    /// Generate the whole mip pyramid for a grid, finest level first.
+    /// Mostly useful for precomputing: the coarse levels add about 30% on
+    /// top of the full-resolution cost.
+    pub fn generate_lod_pyramid(&self, grid_coord: GridCoordinate) -> Vec<HeightMap> {
+        (0..=MAX_LOD)
+            .map(|lod| self.generate_heightmap_lod(grid_coord.clone(), lod))
+            .collect()
+    }
+
+    /// Refine a coarse heightmap in place to a finer LOD. Call when a
+    /// player approaches a grid that was generated for the far distance.
+    pub fn refine_heightmap(
+        &self,
+        grid_coord: GridCoordinate,
+        heightmap: &mut HeightMap,
+        target_lod: u32,
+    ) {
+        let target_lod = target_lod.min(MAX_LOD);
+        if target_lod >= heightmap.lod {
+            return;
         }
+        *heightmap = self.generate_heightmap_lod(grid_coord, target_lod);
     }
 
     fn apply_erosion(&self, height: f64, x: f64, z: f64) -> f64 {
@@ -241,18 +325,18 @@ pub struct TerrainPatch {
 impl TerrainPatch {
     fn smooth_terrain(&mut self, factor: f64) {
         // Apply smoothing filter
-        let size = self.heightmap.data.len();
-        let mut smoothed = vec![vec![0.0; size]; size];
+        let size = self.heightmap.size;
+        let mut smoothed = vec![0.0; size * size];
 
         for x in 1..size-1 {
             for z in 1..size-1 {
                 let mut sum = 0.0;
                 for dx in -1..=1 {
                     for dz in -1..=1 {
-                        sum += self.heightmap.data[(x as i32 + dx) as usize][(z as i32 + dz) as usize];
+                        sum += self.heightmap.get((x as i32 + dx) as usize, (z as i32 + dz) as usize);
                     }
                 }
-                smoothed[x][z] = self.heightmap.data[x][z] * (1.0 - factor) + (sum / 9.0) * factor;
+                smoothed[x * size + z] = self.heightmap.get(x, z) * (1.0 - factor) + (sum / 9.0) * factor;
             }
         }
 
@@ -261,12 +345,13 @@ impl TerrainPatch {
 
     fn roughen_terrain(&mut self, factor: f64) {
         let noise = Perlin::new(42);
-        let size = self.heightmap.data.len();
+        let size = self.heightmap.size;
 
         for x in 0..size {
             for z in 0..size {
                 let roughness = noise.get([x as f64 * 0.1, z as f64 * 0.1]) * factor * 10.0;
-                self.heightmap.data[x][z] += roughness;
+                let current = self.heightmap.get(x, z);
+                self.heightmap.set(x, z, current + roughness);
             }
         }
     }
@@ -308,13 +393,30 @@ impl GridCoordinate {
     }
 }
 
+/// Heightmap samples in a single contiguous allocation, row-major over x
+/// (sample `(x, z)` lives at `data[x * size + z]`).
 #[derive(Debug, Clone)]
 pub struct HeightMap {
-    pub data: Vec<Vec<f64>>,
+    pub data: Vec<f64>,
+    pub size: usize,
+    /// Mip level this map was generated at; 0 is full resolution.
+    pub lod: u32,
     pub min_height: f64,
     pub max_height: f64,
 }
 
+impl HeightMap {
+    #[inline]
+    pub fn get(&self, x: usize, z: usize) -> f64 {
+        self.data[x * self.size + z]
+    }
+
+    #[inline]
+    pub fn set(&mut self, x: usize, z: usize, height: f64) {
+        self.data[x * self.size + z] = height;
+    }
+}
+
 #[derive(Debug, Clone)]
 pub struct TextureLayer {
     pub texture_id: String,
@@ -0,0 +1,248 @@
+// crates/world3d/src/terrain_streaming.rs
+// Tiled, quantized terrain encoding for streaming grids over gRPC.
+//
+// A whole 256x256 heightmap as f32 values is megabytes on the wire and the
+// client can render nothing until the last byte lands. Instead the terrain
+// is cut into tiles, each quantized to 16 bits against its own height range,
+// delta-encoded in row-major order and deflate-compressed. Encoding emits a
+// coarse whole-grid tile first so one small chunk is enough for a first
+// render, with full-resolution tiles refining it afterwards.
+use crate::terrain::{TerrainPatch, GRID_RESOLUTION};
+use flate2::read::DeflateDecoder;
+use flate2::write::DeflateEncoder;
+use flate2::Compression;
+use serde::{Deserialize, Serialize};
+use std::io::{Read, Write};
+
+/// Edge length of a full-resolution tile in heightmap cells.
+pub const TILE_SIZE: usize = 64;
+
+/// LOD of the coarse preview tile: the whole grid sampled every
+/// 2^COARSE_LOD cells (256 -> 32x32, under 2 KiB compressed).
+pub const COARSE_LOD: u32 = 3;
+
+/// One encoded heightmap tile. Mirrors `TerrainTile` in
+/// `proto/world3d.proto`; lod 0 tiles are full resolution, lod N covers the
+/// whole grid sampled every 2^N cells.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct TerrainTile {
+    pub tile_x: u32,
+    pub tile_y: u32,
+    pub lod: u32,
+    pub size: u32,
+    pub min_height: f32,
+    pub height_scale: f32,
+    pub heights: Vec<u8>,
+}
+
+impl TerrainTile {
+    fn encode(tile_x: u32, tile_y: u32, lod: u32, samples: &[f32], size: usize) -> Self {
+        let mut min = f32::INFINITY;
+        let mut max = f32::NEG_INFINITY;
+        for &h in samples {
+            min = min.min(h);
+            max = max.max(h);
+        }
+        if !min.is_finite() {
+            min = 0.0;
+            max = 0.0;
+        }
+        let scale = (max - min).max(f32::EPSILON);
+
+        // Quantize against the tile's own range, then delta-encode: terrain
+        // is locally smooth, so deltas are small and deflate well
+        let mut deltas = Vec::with_capacity(samples.len() * 2);
+        let mut previous: u16 = 0;
+        for &h in samples {
+            let q = (((h - min) / scale) * u16::MAX as f32).round() as u16;
+            let delta = q.wrapping_sub(previous);
+            deltas.extend_from_slice(&delta.to_le_bytes());
+            previous = q;
+        }
+
+        let mut encoder = DeflateEncoder::new(Vec::new(), Compression::fast());
+        encoder.write_all(&deltas).expect("deflate to Vec cannot fail");
+        let heights = encoder.finish().expect("deflate to Vec cannot fail");
+
+        Self {
+            tile_x,
+            tile_y,
+            lod,
+            size: size as u32,
+            min_height: min,
+            height_scale: scale,
+            heights,
+        }
+    }
+
+    /// Decode back to `size * size` height samples in row-major order.
+    pub fn decode(&self) -> Vec<f32> {
+        let mut deltas = Vec::new();
+        if DeflateDecoder::new(self.heights.as_slice())
+            .read_to_end(&mut deltas)
+            .is_err()
+        {
+            return Vec::new();
+        }
+
+        let mut samples = Vec::with_capacity(deltas.len() / 2);
+        let mut previous: u16 = 0;
+        for pair in deltas.chunks_exact(2) {
+            previous = previous.wrapping_add(u16::from_le_bytes([pair[0], pair[1]]));
+            let h = self.min_height
+                + (previous as f32 / u16::MAX as f32) * self.height_scale;
+            samples.push(h);
+        }
+        samples
+    }
+}
+
+/// Encode a patch as a stream-ordered tile list: the coarse preview tile
+/// first, then full-resolution tiles row by row.
+pub fn encode_terrain_tiles(patch: &TerrainPatch) -> Vec<TerrainTile> {
+    let resolution = patch.heightmap.len().min(GRID_RESOLUTION);
+    if resolution == 0 {
+        return Vec::new();
+    }
+
+    let mut tiles = Vec::new();
+
+    // Coarse pass: whole grid at 1/2^COARSE_LOD resolution
+    let stride = 1 << COARSE_LOD;
+    let coarse_size = resolution / stride;
+    if coarse_size > 0 {
+        let mut samples = Vec::with_capacity(coarse_size * coarse_size);
+        for z in 0..coarse_size {
+            for x in 0..coarse_size {
+                samples.push(patch.heightmap[x * stride][z * stride]);
+            }
+        }
+        tiles.push(TerrainTile::encode(0, 0, COARSE_LOD, &samples, coarse_size));
+    }
+
+    // Detail pass: full-resolution tiles
+    let tiles_per_side = (resolution + TILE_SIZE - 1) / TILE_SIZE;
+    for tile_y in 0..tiles_per_side {
+        for tile_x in 0..tiles_per_side {
+            let x0 = tile_x * TILE_SIZE;
+            let z0 = tile_y * TILE_SIZE;
+            let size = TILE_SIZE.min(resolution - x0).min(resolution - z0);
+
+            let mut samples = Vec::with_capacity(size * size);
+            for z in 0..size {
+                for x in 0..size {
+                    samples.push(patch.heightmap[x0 + x][z0 + z]);
+                }
+            }
+            tiles.push(TerrainTile::encode(
+                tile_x as u32,
+                tile_y as u32,
+                0,
+                &samples,
+                size,
+            ));
+        }
+    }
+
+    tiles
+}
+
+/// Client-side assembly: applies tiles as they arrive, coarse ones by
+/// upsampling so the heightmap is fully populated after the first chunk.
+pub struct TerrainAssembler {
+    pub heightmap: Vec<Vec<f32>>,
+    resolution: usize,
+}
+
+impl TerrainAssembler {
+    pub fn new(resolution: usize) -> Self {
+        Self {
+            heightmap: vec![vec![0.0; resolution]; resolution],
+            resolution,
+        }
+    }
+
+    pub fn apply(&mut self, tile: &TerrainTile) {
+        let samples = tile.decode();
+        let size = tile.size as usize;
+        if samples.len() != size * size || size == 0 {
+            return;
+        }
+
+        if tile.lod > 0 {
+            // Coarse tile: nearest-neighbour upsample over the whole grid
+            for x in 0..self.resolution {
+                for z in 0..self.resolution {
+                    let sx = (x * size / self.resolution).min(size - 1);
+                    let sz = (z * size / self.resolution).min(size - 1);
+                    self.heightmap[x][z] = samples[sz * size + sx];
+                }
+            }
+        } else {
+            let x0 = tile.tile_x as usize * TILE_SIZE;
+            let z0 = tile.tile_y as usize * TILE_SIZE;
+            for z in 0..size {
+                for x in 0..size {
+                    if x0 + x < self.resolution && z0 + z < self.resolution {
+                        self.heightmap[x0 + x][z0 + z] = samples[z * size + x];
+                    }
+                }
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::terrain::VegetationMap;
+
+    fn test_patch(resolution: usize) -> TerrainPatch {
+        let heightmap = (0..resolution)
+            .map(|x| {
+                (0..resolution)
+                    .map(|z| ((x as f32 * 0.1).sin() + (z as f32 * 0.07).cos()) * 20.0)
+                    .collect()
+            })
+            .collect();
+        TerrainPatch {
+            heightmap,
+            textures: Vec::new(),
+            vegetation_map: VegetationMap {
+                density: Vec::new(),
+                types: Vec::new(),
+            },
+            water_bodies: Vec::new(),
+        }
+    }
+
+    #[test]
+    fn test_tile_roundtrip_within_quantization_error() {
+        let patch = test_patch(GRID_RESOLUTION);
+        let tiles = encode_terrain_tiles(&patch);
+
+        let mut assembler = TerrainAssembler::new(GRID_RESOLUTION);
+        for tile in &tiles {
+            assembler.apply(tile);
+        }
+
+        // 16-bit quantization over a ~40 unit range
+        let tolerance = 40.0 / u16::MAX as f32 * 2.0;
+        for x in 0..GRID_RESOLUTION {
+            for z in 0..GRID_RESOLUTION {
+                let diff = (assembler.heightmap[x][z] - patch.heightmap[x][z]).abs();
+                assert!(diff <= tolerance, "height off by {} at ({}, {})", diff, x, z);
+            }
+        }
+    }
+
+    #[test]
+    fn test_coarse_tile_streams_first() {
+        let patch = test_patch(GRID_RESOLUTION);
+        let tiles = encode_terrain_tiles(&patch);
+        assert_eq!(tiles[0].lod, COARSE_LOD);
+        assert!(tiles[1..].iter().all(|t| t.lod == 0));
+        // The preview tile must stay small enough to land in one packet
+        assert!(tiles[0].heights.len() < 2048);
+    }
+}
@@ -1,13 +1,47 @@
 use finalverse_core::types::PlayerId;
+use lru::LruCache;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
+use std::num::NonZeroUsize;
 use std::sync::Arc;
-use ort::{Environment, SessionBuilder};
+use std::time::{Duration, Instant};
+use tokio::sync::{broadcast, mpsc, Mutex};
 
-#[derive(Debug, Clone)]
+/// Completions kept in the prompt cache.
+const COMPLETION_CACHE_CAPACITY: usize = 256;
+
+/// How long a cached completion stays valid. Deterministic templates (quest
+/// descriptions, region text) are safe to reuse for this long; anything that
+/// must be fresh should vary its prompt.
+const COMPLETION_TTL: Duration = Duration::from_secs(300);
+
+/// Identity of a completion for caching and in-flight coalescing.
+#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+struct CompletionKey {
+    model: String,
+    prompt: String,
+}
+
+struct CachedCompletion {
+    response: GenerationResponse,
+    cached_at: Instant,
+}
+
+#[derive(Clone)]
 pub struct LLMOrchestra {
     models: HashMap<String, LLMProvider>,
     default_model: String,
+    completion_cache: Arc<Mutex<LruCache<CompletionKey, CachedCompletion>>>,
+    in_flight: Arc<Mutex<HashMap<CompletionKey, broadcast::Sender<Result<GenerationResponse, String>>>>>,
+}
+
+impl std::fmt::Debug for LLMOrchestra {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("LLMOrchestra")
+            .field("models", &self.models)
+            .field("default_model", &self.default_model)
+            .finish_non_exhaustive()
+    }
 }
 
 #[derive(Debug, Clone)]
@@ -57,17 +91,19 @@ pub struct MistralProvider {
 #[derive(Debug, Clone)]
 pub struct LocalProvider {
     pub model_path: String,
-    #[allow(dead_code)]
-    environment: std::sync::Arc<ort::Environment>,
-    #[allow(dead_code)]
-    session: std::sync::Arc<ort::Session>,
 }
 
 impl LocalProvider {
-    pub fn new(model_path: String) -> Result<Self, ort::OrtError> {
-        let environment = Arc::new(Environment::builder().with_name("local-llm").build()?);
-        let session = Arc::new(SessionBuilder::new(&environment)?.with_model_from_file(&model_path)?);
-        Ok(Self { model_path, environment, session })
+    pub fn new(model_path: String) -> Result<Self, std::io::Error> {
+        // Validate the model file up front; actual inference is still TODO
+        // (see generate_local), so we only keep the path around.
+        if !std::path::Path::new(&model_path).exists() {
+            return Err(std::io::Error::new(
+                std::io::ErrorKind::NotFound,
+                format!("local model not found: {}", model_path),
+            ));
+        }
+        Ok(Self { model_path })
     }
 }
 
@@ -80,7 +116,7 @@ pub struct GenerationRequest {
     pub max_tokens: Option<u32>,
 }
 
-#[derive(Debug, Serialize, Deserialize)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct GenerationResponse {
     pub text: String,
     pub model_used: String,
@@ -230,6 +266,10 @@ impl LLMOrchestra {
         Self {
             models,
             default_model,
+            completion_cache: Arc::new(Mutex::new(LruCache::new(
+                NonZeroUsize::new(COMPLETION_CACHE_CAPACITY).unwrap(),
+            ))),
+            in_flight: Arc::new(Mutex::new(HashMap::new())),
         }
     }
 
@@ -238,6 +278,103 @@ impl LLMOrchestra {
     }
 
     pub async fn generate(&self, request: GenerationRequest) -> Result<GenerationResponse, Box<dyn std::error::Error + Send + Sync>> {
+        let key = CompletionKey {
+            model: self.default_model.clone(),
+            prompt: request.prompt.clone(),
+        };
+
+        // Prompt cache: identical (model, prompt) within the TTL reuses the
+        // completion without a model round trip
+        if let Some(hit) = self.cached_completion(&key).await {
+            return Ok(hit);
+        }
+
+        // Coalesce identical in-flight prompts: the first caller becomes the
+        // leader and runs the request; everyone else waits on its channel.
+        let tx = {
+            let mut in_flight = self.in_flight.lock().await;
+            if let Some(tx) = in_flight.get(&key) {
+                let mut rx = tx.subscribe();
+                drop(in_flight);
+                return match rx.recv().await {
+                    Ok(Ok(response)) => Ok(response),
+                    Ok(Err(message)) => Err(message.into()),
+                    Err(_) => Err("Coalesced generation was dropped".into()),
+                };
+            }
+            let (tx, _) = broadcast::channel(1);
+            in_flight.insert(key.clone(), tx.clone());
+            tx
+        };
+
+        let result = self.generate_uncached(request).await;
+
+        self.in_flight.lock().await.remove(&key);
+        match &result {
+            Ok(response) => {
+                self.completion_cache.lock().await.put(
+                    key,
+                    CachedCompletion {
+                        response: response.clone(),
+                        cached_at: Instant::now(),
+                    },
+                );
+                let _ = tx.send(Ok(response.clone()));
+            }
+            Err(e) => {
+                let _ = tx.send(Err(e.to_string()));
+            }
+        }
+
+        result
+    }
+
+    /// Streaming generation: returns a channel of text fragments so callers
+    /// can render quest text as tokens arrive. Ollama streams natively;
+    /// other providers fall back to delivering the finished completion as a
+    /// single fragment (still going through the cache and coalescing).
+    pub async fn generate_streaming(
+        &self,
+        request: GenerationRequest,
+    ) -> Result<mpsc::Receiver<String>, Box<dyn std::error::Error + Send + Sync>> {
+        let provider = self.models.get(&self.default_model)
+            .ok_or("Default model not found")?;
+
+        let (tx, rx) = mpsc::channel(32);
+
+        match provider {
+            LLMProvider::Ollama(ollama) => {
+                let provider = ollama.clone();
+                tokio::spawn(async move {
+                    let _ = stream_ollama(provider, request, tx).await;
+                });
+            }
+            _ => {
+                let response = self.generate(request).await?;
+                tokio::spawn(async move {
+                    let _ = tx.send(response.text).await;
+                });
+            }
+        }
+
+        Ok(rx)
+    }
+
+    async fn cached_completion(&self, key: &CompletionKey) -> Option<GenerationResponse> {
+        let mut cache = self.completion_cache.lock().await;
+        match cache.get(key) {
+            Some(cached) if cached.cached_at.elapsed() < COMPLETION_TTL => {
+                Some(cached.response.clone())
+            }
+            Some(_) => {
+                cache.pop(key);
+                None
+            }
+            None => None,
+        }
+    }
+
+    async fn generate_uncached(&self, request: GenerationRequest) -> Result<GenerationResponse, Box<dyn std::error::Error + Send + Sync>> {
         let provider = self.models.get(&self.default_model)
             .ok_or("Default model not found")?;
 
@@ -472,6 +609,59 @@ impl LLMOrchestra {
     }
 }
 
+/// Drive one streaming Ollama generation, forwarding each response fragment
+/// as it arrives.
+async fn stream_ollama(
+    provider: OllamaProvider,
+    request: GenerationRequest,
+    tx: mpsc::Sender<String>,
+) -> Result<(), Box<dyn std::error::Error + Send + Sync>> {
+    let client = reqwest::Client::new();
+
+    let ollama_request = OllamaRequest {
+        model: provider.model_name.clone(),
+        prompt: request.prompt,
+        stream: true,
+        options: OllamaOptions {
+            temperature: request.temperature.unwrap_or(0.7),
+            max_tokens: request.max_tokens.unwrap_or(2048),
+        },
+    };
+
+    let mut response = client
+        .post(&format!("{}/api/generate", provider.base_url))
+        .json(&ollama_request)
+        .send()
+        .await?;
+
+    if !response.status().is_success() {
+        return Err(format!("Ollama request failed with status: {}", response.status()).into());
+    }
+
+    // Ollama streams newline-delimited JSON objects; fragments can split
+    // across network chunks, so buffer until each full line arrives
+    let mut line_buffer = Vec::new();
+    while let Some(chunk) = response.chunk().await? {
+        line_buffer.extend_from_slice(&chunk);
+
+        while let Some(newline) = line_buffer.iter().position(|&b| b == b'\n') {
+            let line: Vec<u8> = line_buffer.drain(..=newline).collect();
+            if let Ok(fragment) = serde_json::from_slice::<OllamaResponse>(&line) {
+                if !fragment.response.is_empty()
+                    && tx.send(fragment.response).await.is_err()
+                {
+                    return Ok(());
+                }
+                if fragment.done {
+                    return Ok(());
+                }
+            }
+        }
+    }
+
+    Ok(())
+}
+
 // Narrative AI functions
 pub async fn generate_quest_narrative(
     orchestra: &LLMOrchestra,
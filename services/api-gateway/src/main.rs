@@ -6,6 +6,8 @@ use std::{net::SocketAddr, sync::Arc};
 use tracing::info;
 use finalverse_logging as logging;
 
+mod proxy;
+
 #[tokio::main]
 async fn main() -> Result<(), Box<dyn std::error::Error>> {
     logging::init(None);
@@ -17,6 +19,7 @@ async fn main() -> Result<(), Box<dyn std::error::Error>> {
 
     let app = Router::new()
         .merge(monitor.clone().axum_routes())
+        .merge(proxy::routes(proxy::ProxyState::new(registry.clone())))
         .route("/login", post(login_handler));
 
     let addr = SocketAddr::from(([0, 0, 0, 0], 8080));
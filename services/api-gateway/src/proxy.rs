@@ -0,0 +1,117 @@
+// services/api-gateway/src/proxy.rs
+// Streaming reverse proxy: /api/:service/*path fans out to the backend
+// registered under that name. Bodies are forwarded as streams in both
+// directions, so large payloads (terrain tiles, audio) pass through in
+// constant memory, and the shared reqwest client keeps pooled keep-alive
+// connections to each upstream.
+use axum::{
+    body::Body,
+    extract::{Path, Request, State},
+    http::{header, HeaderName, StatusCode},
+    response::{IntoResponse, Response},
+    routing::any,
+    Router,
+};
+use service_registry::LocalServiceRegistry;
+use std::sync::Arc;
+use std::time::Duration;
+use tracing::warn;
+
+pub struct ProxyState {
+    registry: LocalServiceRegistry,
+    client: reqwest::Client,
+}
+
+impl ProxyState {
+    pub fn new(registry: LocalServiceRegistry) -> Arc<Self> {
+        // One pooled client for all upstreams: connections are kept alive
+        // per host, so a proxied request normally reuses a warm socket
+        let client = reqwest::Client::builder()
+            .pool_max_idle_per_host(32)
+            .pool_idle_timeout(Duration::from_secs(90))
+            .tcp_keepalive(Duration::from_secs(60))
+            .connect_timeout(Duration::from_secs(5))
+            .build()
+            .expect("failed to build proxy http client");
+
+        Arc::new(Self { registry, client })
+    }
+}
+
+pub fn routes(state: Arc<ProxyState>) -> Router {
+    Router::new()
+        .route("/api/:service/*path", any(proxy_handler))
+        .with_state(state)
+}
+
+/// Hop-by-hop headers (RFC 9110 §7.6.1) apply to a single connection and
+/// must not be forwarded through the proxy in either direction.
+fn is_hop_by_hop(name: &HeaderName) -> bool {
+    matches!(
+        name.as_str(),
+        "connection"
+            | "keep-alive"
+            | "proxy-authenticate"
+            | "proxy-authorization"
+            | "te"
+            | "trailer"
+            | "transfer-encoding"
+            | "upgrade"
+    )
+}
+
+async fn proxy_handler(
+    State(state): State<Arc<ProxyState>>,
+    Path((service, path)): Path<(String, String)>,
+    req: Request,
+) -> Response {
+    let Some(base) = state.registry.resolve(&service) else {
+        return (
+            StatusCode::BAD_GATEWAY,
+            format!("unknown service: {}", service),
+        )
+            .into_response();
+    };
+
+    let mut target = format!("{}/{}", base, path);
+    if let Some(query) = req.uri().query() {
+        target.push('?');
+        target.push_str(query);
+    }
+
+    // Hand the request body to the upstream as a stream — nothing is
+    // buffered in the gateway
+    let (parts, body) = req.into_parts();
+    let mut upstream = state
+        .client
+        .request(parts.method, &target)
+        .body(reqwest::Body::wrap_stream(body.into_data_stream()));
+    for (name, value) in parts.headers.iter() {
+        if !is_hop_by_hop(name) && name != header::HOST {
+            upstream = upstream.header(name, value);
+        }
+    }
+
+    match upstream.send().await {
+        Ok(resp) => {
+            let mut builder = Response::builder().status(resp.status());
+            for (name, value) in resp.headers() {
+                if !is_hop_by_hop(name) {
+                    builder = builder.header(name, value);
+                }
+            }
+            // Likewise stream the response straight back to the client
+            builder
+                .body(Body::from_stream(resp.bytes_stream()))
+                .unwrap_or_else(|_| StatusCode::BAD_GATEWAY.into_response())
+        }
+        Err(e) => {
+            warn!("proxy to {} ({}) failed: {}", service, target, e);
+            (
+                StatusCode::BAD_GATEWAY,
+                format!("upstream {} unreachable", service),
+            )
+                .into_response()
+        }
+    }
+}
@@ -5,6 +5,8 @@ use std::{net::SocketAddr, sync::Arc};
 use tracing::info;
 use finalverse_logging as logging;
 
+mod store;
+
 #[tokio::main]
 async fn main() -> Result<(), Box<dyn std::error::Error>> {
     logging::init(None);
@@ -14,7 +16,12 @@ async fn main() -> Result<(), Box<dyn std::error::Error>> {
         .register_service("asset-service".to_string(), "http://localhost:3007".to_string())
         .await;
 
-    let app = Router::new().merge(monitor.clone().axum_routes());
+    let store_dir = std::env::var("ASSET_STORE_DIR").unwrap_or_else(|_| "asset_store".to_string());
+    let asset_store = store::AssetStore::new(store_dir.into())?;
+
+    let app = Router::new()
+        .merge(monitor.clone().axum_routes())
+        .merge(store::routes(asset_store));
 
     let addr = SocketAddr::from(([0, 0, 0, 0], 3007));
     info!("Asset Service listening on {}", addr);
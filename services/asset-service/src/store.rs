@@ -0,0 +1,252 @@
+// services/asset-service/src/store.rs
+// Content-addressed asset store. Assets are ingested under the SHA-256 of
+// their bytes and served memory-mapped: the mmap is wrapped in a Bytes
+// owner, so responses (including range slices) reference the page cache
+// directly with no per-request heap copy. Because a hash names immutable
+// content, responses carry `Cache-Control: immutable` and the hash as a
+// strong ETag — repeat downloads of the first-hour asset set are either
+// 304s or served straight from warm pages.
+use axum::{
+    body::Body,
+    extract::{Path, State},
+    http::{header, HeaderMap, StatusCode},
+    response::{IntoResponse, Response},
+    routing::{get, put},
+    Json, Router,
+};
+use bytes::Bytes;
+use dashmap::DashMap;
+use memmap2::Mmap;
+use serde::Serialize;
+use sha2::{Digest, Sha256};
+use std::fs::{self, File};
+use std::path::PathBuf;
+use std::sync::Arc;
+use tracing::info;
+
+pub struct AssetStore {
+    root: PathBuf,
+    // hash -> mapped file, shared by every in-flight response
+    mapped: DashMap<String, Bytes>,
+}
+
+#[derive(Serialize)]
+pub struct IngestResponse {
+    pub hash: String,
+    pub size: usize,
+}
+
+impl AssetStore {
+    pub fn new(root: PathBuf) -> std::io::Result<Arc<Self>> {
+        fs::create_dir_all(&root)?;
+        Ok(Arc::new(Self {
+            root,
+            mapped: DashMap::new(),
+        }))
+    }
+
+    /// `ab/cdef…` layout so one directory never accumulates every asset.
+    fn path_for(&self, hash: &str) -> PathBuf {
+        self.root.join(&hash[..2]).join(&hash[2..])
+    }
+
+    /// Store `data` under its content hash. Idempotent: re-ingesting the
+    /// same bytes is a no-op that returns the same hash.
+    pub fn ingest(&self, data: &[u8]) -> std::io::Result<IngestResponse> {
+        let hash = format!("{:x}", Sha256::digest(data));
+        let path = self.path_for(&hash);
+
+        if !path.exists() {
+            fs::create_dir_all(path.parent().unwrap())?;
+            // Write-then-rename so readers never observe a partial asset
+            let tmp = path.with_extension("tmp");
+            fs::write(&tmp, data)?;
+            fs::rename(&tmp, &path)?;
+        }
+
+        Ok(IngestResponse {
+            hash,
+            size: data.len(),
+        })
+    }
+
+    /// The full asset bytes, memory-mapped on first access. Slicing the
+    /// returned `Bytes` for range requests is zero-copy.
+    pub fn open(&self, hash: &str) -> Option<Bytes> {
+        if let Some(bytes) = self.mapped.get(hash) {
+            return Some(bytes.clone());
+        }
+        if hash.len() < 3 || !hash.bytes().all(|b| b.is_ascii_hexdigit()) {
+            return None;
+        }
+
+        let file = File::open(self.path_for(hash)).ok()?;
+        // Safety: stored assets are immutable once renamed into place —
+        // nothing in this process (or the generator) rewrites them
+        let mmap = unsafe { Mmap::map(&file).ok()? };
+        let bytes = Bytes::from_owner(mmap);
+        self.mapped.insert(hash.to_string(), bytes.clone());
+        Some(bytes)
+    }
+}
+
+pub fn routes(store: Arc<AssetStore>) -> Router {
+    Router::new()
+        .route("/assets", put(ingest_handler))
+        .route("/assets/:hash", get(serve_handler))
+        .with_state(store)
+}
+
+async fn ingest_handler(
+    State(store): State<Arc<AssetStore>>,
+    body: Bytes,
+) -> Result<Json<IngestResponse>, StatusCode> {
+    let store = store.clone();
+    // Hashing and the durable write are blocking work
+    let result = tokio::task::spawn_blocking(move || store.ingest(&body))
+        .await
+        .map_err(|_| StatusCode::INTERNAL_SERVER_ERROR)?;
+
+    match result {
+        Ok(resp) => {
+            info!("ingested asset {} ({} bytes)", resp.hash, resp.size);
+            Ok(Json(resp))
+        }
+        Err(e) => {
+            tracing::error!("asset ingest failed: {}", e);
+            Err(StatusCode::INTERNAL_SERVER_ERROR)
+        }
+    }
+}
+
+async fn serve_handler(
+    State(store): State<Arc<AssetStore>>,
+    Path(hash): Path<String>,
+    headers: HeaderMap,
+) -> Response {
+    // The hash is the content: If-None-Match short-circuits before any I/O
+    if let Some(etag) = headers.get(header::IF_NONE_MATCH) {
+        if etag.as_bytes() == format!("\"{}\"", hash).as_bytes() {
+            return StatusCode::NOT_MODIFIED.into_response();
+        }
+    }
+
+    let Some(bytes) = store.open(&hash) else {
+        return StatusCode::NOT_FOUND.into_response();
+    };
+    let total = bytes.len();
+
+    let (status, slice, content_range) = match parse_range(&headers, total) {
+        Some(Ok((start, end))) => (
+            StatusCode::PARTIAL_CONTENT,
+            bytes.slice(start..=end),
+            Some(format!("bytes {}-{}/{}", start, end, total)),
+        ),
+        Some(Err(())) => {
+            return (
+                StatusCode::RANGE_NOT_SATISFIABLE,
+                [(header::CONTENT_RANGE, format!("bytes */{}", total))],
+            )
+                .into_response();
+        }
+        None => (StatusCode::OK, bytes, None),
+    };
+
+    let mut builder = Response::builder()
+        .status(status)
+        .header(header::CONTENT_TYPE, "application/octet-stream")
+        .header(header::CONTENT_LENGTH, slice.len())
+        .header(header::ACCEPT_RANGES, "bytes")
+        .header(header::ETAG, format!("\"{}\"", hash))
+        .header(
+            header::CACHE_CONTROL,
+            "public, max-age=31536000, immutable",
+        );
+    if let Some(range) = content_range {
+        builder = builder.header(header::CONTENT_RANGE, range);
+    }
+    builder
+        .body(Body::from(slice))
+        .unwrap_or_else(|_| StatusCode::INTERNAL_SERVER_ERROR.into_response())
+}
+
+/// Parse a single `bytes=start-end` range. `None` means no/unsupported
+/// range header (serve the whole asset); `Some(Err(()))` means the header
+/// was a byte range but unsatisfiable.
+fn parse_range(headers: &HeaderMap, total: usize) -> Option<Result<(usize, usize), ()>> {
+    let spec = headers
+        .get(header::RANGE)?
+        .to_str()
+        .ok()?
+        .strip_prefix("bytes=")?;
+    // Multi-range requests are rare from our clients; serve them the
+    // whole asset rather than a multipart body
+    if spec.contains(',') || total == 0 {
+        return None;
+    }
+
+    let (start, end) = spec.split_once('-')?;
+    let parsed = if start.is_empty() {
+        // Suffix range: last N bytes
+        let n: usize = end.parse().ok()?;
+        if n == 0 {
+            return Some(Err(()));
+        }
+        (total.saturating_sub(n), total - 1)
+    } else {
+        let start: usize = start.parse().ok()?;
+        let end = if end.is_empty() {
+            total - 1
+        } else {
+            end.parse::<usize>().ok()?.min(total - 1)
+        };
+        if start > end || start >= total {
+            return Some(Err(()));
+        }
+        (start, end)
+    };
+    Some(Ok(parsed))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_ingest_is_idempotent_and_content_addressed() {
+        let dir = std::env::temp_dir().join(format!("asset-store-{}", std::process::id()));
+        let store = AssetStore::new(dir.clone()).unwrap();
+
+        let a = store.ingest(b"terrain tile payload").unwrap();
+        let b = store.ingest(b"terrain tile payload").unwrap();
+        assert_eq!(a.hash, b.hash);
+        assert_eq!(a.size, 20);
+
+        let bytes = store.open(&a.hash).unwrap();
+        assert_eq!(&bytes[..], b"terrain tile payload");
+        // Second open comes from the mmap cache and shares the same buffer
+        let again = store.open(&a.hash).unwrap();
+        assert_eq!(bytes.as_ptr(), again.as_ptr());
+
+        assert!(store.open("00ff_not_a_real_hash").is_none());
+        fs::remove_dir_all(dir).ok();
+    }
+
+    #[test]
+    fn test_parse_range() {
+        let mut headers = HeaderMap::new();
+        assert!(parse_range(&headers, 100).is_none());
+
+        headers.insert(header::RANGE, "bytes=0-49".parse().unwrap());
+        assert_eq!(parse_range(&headers, 100), Some(Ok((0, 49))));
+
+        headers.insert(header::RANGE, "bytes=50-".parse().unwrap());
+        assert_eq!(parse_range(&headers, 100), Some(Ok((50, 99))));
+
+        headers.insert(header::RANGE, "bytes=-10".parse().unwrap());
+        assert_eq!(parse_range(&headers, 100), Some(Ok((90, 99))));
+
+        headers.insert(header::RANGE, "bytes=200-".parse().unwrap());
+        assert_eq!(parse_range(&headers, 100), Some(Err(())));
+    }
+}
@@ -1,6 +1,9 @@
 // services/first-hour/src/asset_generator.rs
-use finalverse_world3d::assets::{AssetManifest, MeshAsset};
+use finalverse_world3d::assets::AssetManifest;
+use finalverse_world3d::mesh_format::{MeshData, MeshVertex};
+use std::f32::consts::TAU;
 use std::path::PathBuf;
+use tokio::task::JoinSet;
 
 pub struct FirstHourAssetGenerator {
     output_dir: PathBuf,
@@ -19,11 +22,30 @@ impl FirstHourAssetGenerator {
         // Create directory structure
         self.create_directory_structure().await?;
 
-        // Generate procedural meshes
-        self.generate_procedural_meshes().await?;
+        // Mesh and texture generation are independent CPU-bound jobs;
+        // fan them out across the blocking pool and join at the end
+        let mut jobs = JoinSet::new();
 
-        // Generate textures
-        self.generate_textures().await?;
+        for variant in 1..=4u32 {
+            let out = self.output_dir.clone();
+            jobs.spawn_blocking(move || generate_crystal_mesh(&out, variant));
+        }
+        for variant in 1..=2u32 {
+            let out = self.output_dir.clone();
+            jobs.spawn_blocking(move || generate_willow_mesh(&out, variant));
+        }
+        {
+            let out = self.output_dir.clone();
+            jobs.spawn_blocking(move || generate_terrain_textures(&out));
+        }
+        {
+            let out = self.output_dir.clone();
+            jobs.spawn_blocking(move || generate_effect_textures(&out));
+        }
+
+        while let Some(result) = jobs.join_next().await {
+            result??;
+        }
 
         // Export asset manifest
         self.export_manifest().await?;
@@ -51,69 +73,135 @@ impl FirstHourAssetGenerator {
         Ok(())
     }
 
-    async fn generate_procedural_meshes(&self) -> anyhow::Result<()> {
-        // Generate memory crystal variations
-        for i in 1..=4 {
-            self.generate_crystal_mesh(i).await?;
-        }
-
-        // Generate vegetation
-        self.generate_vegetation_meshes().await?;
+    async fn export_manifest(&self) -> anyhow::Result<()> {
+        let manifest_path = self.output_dir.join("asset_manifest.json");
+        let manifest_json = serde_json::to_string_pretty(&self.manifest)?;
+        tokio::fs::write(manifest_path, manifest_json).await?;
 
+        tracing::info!("Asset manifest exported");
         Ok(())
     }
+}
 
-    async fn generate_crystal_mesh(&self, variant: u32) -> anyhow::Result<()> {
-        // This would use a procedural mesh generation algorithm
-        // For now, we'll create a placeholder
-        tracing::info!("Generating crystal variant {}", variant);
-
-        // In a real implementation, this would generate actual 3D geometry
-        // using algorithms like:
-        // - Voronoi diagrams for crystal structure
-        // - Subdivision surfaces for smooth organic shapes
-        // - L-systems for vegetation
-
-        Ok(())
+/// Memory crystal: a hexagonal bipyramid whose proportions vary with the
+/// variant seed. Written as compact binary (.fvm) so clients load the
+/// vertex and index buffers with a single read.
+fn generate_crystal_mesh(output_dir: &PathBuf, variant: u32) -> anyhow::Result<()> {
+    tracing::info!("Generating crystal variant {}", variant);
+
+    let sides = 6;
+    let radius = 0.4 + variant as f32 * 0.1;
+    let height = 1.2 + variant as f32 * 0.3;
+
+    let mut mesh = MeshData::default();
+    // Equator ring
+    for i in 0..sides {
+        let angle = i as f32 / sides as f32 * TAU;
+        let (sin, cos) = angle.sin_cos();
+        mesh.vertices.push(MeshVertex {
+            position: [cos * radius, 0.0, sin * radius],
+            normal: [cos, 0.0, sin],
+            uv: [i as f32 / sides as f32, 0.5],
+        });
     }
-
-    async fn generate_vegetation_meshes(&self) -> anyhow::Result<()> {
-        // Generate tree variants using L-systems
-        tracing::info!("Generating vegetation meshes");
-
-        Ok(())
+    // Apexes
+    let top = mesh.vertices.len() as u32;
+    mesh.vertices.push(MeshVertex {
+        position: [0.0, height, 0.0],
+        normal: [0.0, 1.0, 0.0],
+        uv: [0.5, 1.0],
+    });
+    let bottom = mesh.vertices.len() as u32;
+    mesh.vertices.push(MeshVertex {
+        position: [0.0, -height * 0.6, 0.0],
+        normal: [0.0, -1.0, 0.0],
+        uv: [0.5, 0.0],
+    });
+
+    for i in 0..sides as u32 {
+        let next = (i + 1) % sides as u32;
+        mesh.indices.extend_from_slice(&[i, top, next]);
+        mesh.indices.extend_from_slice(&[next, bottom, i]);
     }
 
-    async fn generate_textures(&self) -> anyhow::Result<()> {
-        // Generate terrain textures
-        self.generate_terrain_textures().await?;
-
-        // Generate effect textures
-        self.generate_effect_textures().await?;
+    let path = output_dir
+        .join("meshes/environment")
+        .join(format!("memory_crystal_{:02}.fvm", variant));
+    std::fs::write(path, mesh.encode())?;
+    Ok(())
+}
 
-        Ok(())
+/// Willow tree: trunk cylinder plus a canopy cone. Placeholder geometry
+/// until the L-system generator lands, but real buffers in the real format.
+fn generate_willow_mesh(output_dir: &PathBuf, variant: u32) -> anyhow::Result<()> {
+    tracing::info!("Generating willow variant {}", variant);
+
+    let sides = 8;
+    let trunk_radius = 0.25;
+    let trunk_height = 2.0 + variant as f32 * 0.5;
+    let canopy_radius = 1.5 + variant as f32 * 0.25;
+
+    let mut mesh = MeshData::default();
+    // Trunk: two rings
+    for ring in 0..2u32 {
+        let y = ring as f32 * trunk_height;
+        for i in 0..sides {
+            let angle = i as f32 / sides as f32 * TAU;
+            let (sin, cos) = angle.sin_cos();
+            mesh.vertices.push(MeshVertex {
+                position: [cos * trunk_radius, y, sin * trunk_radius],
+                normal: [cos, 0.0, sin],
+                uv: [i as f32 / sides as f32, ring as f32 * 0.5],
+            });
+        }
+    }
+    for i in 0..sides as u32 {
+        let next = (i + 1) % sides as u32;
+        let (a, b) = (i, i + sides as u32);
+        let (c, d) = (next, next + sides as u32);
+        mesh.indices.extend_from_slice(&[a, b, c, c, b, d]);
     }
 
-    async fn generate_terrain_textures(&self) -> anyhow::Result<()> {
-        // Generate grass, rock, sand textures procedurally
-        tracing::info!("Generating terrain textures");
-
-        Ok(())
+    // Canopy: ring at trunk top plus a peak
+    let base = mesh.vertices.len() as u32;
+    for i in 0..sides {
+        let angle = i as f32 / sides as f32 * TAU;
+        let (sin, cos) = angle.sin_cos();
+        mesh.vertices.push(MeshVertex {
+            position: [cos * canopy_radius, trunk_height, sin * canopy_radius],
+            normal: [cos * 0.7, 0.7, sin * 0.7],
+            uv: [i as f32 / sides as f32, 0.75],
+        });
+    }
+    let peak = mesh.vertices.len() as u32;
+    mesh.vertices.push(MeshVertex {
+        position: [0.0, trunk_height + canopy_radius, 0.0],
+        normal: [0.0, 1.0, 0.0],
+        uv: [0.5, 1.0],
+    });
+    for i in 0..sides as u32 {
+        let next = (i + 1) % sides as u32;
+        mesh.indices
+            .extend_from_slice(&[base + i, peak, base + next]);
     }
 
-    async fn generate_effect_textures(&self) -> anyhow::Result<()> {
-        // Generate glow maps, particle textures, etc.
-        tracing::info!("Generating effect textures");
+    let path = output_dir
+        .join("meshes/environment")
+        .join(format!("tree_willow_{:02}.fvm", variant));
+    std::fs::write(path, mesh.encode())?;
+    Ok(())
+}
 
-        Ok(())
-    }
+fn generate_terrain_textures(_output_dir: &PathBuf) -> anyhow::Result<()> {
+    // Generate grass, rock, sand textures procedurally
+    tracing::info!("Generating terrain textures");
 
-    async fn export_manifest(&self) -> anyhow::Result<()> {
-        let manifest_path = self.output_dir.join("asset_manifest.json");
-        let manifest_json = serde_json::to_string_pretty(&self.manifest)?;
-        tokio::fs::write(manifest_path, manifest_json).await?;
+    Ok(())
+}
 
-        tracing::info!("Asset manifest exported");
-        Ok(())
-    }
-}
\ No newline at end of file
+fn generate_effect_textures(_output_dir: &PathBuf) -> anyhow::Result<()> {
+    // Generate glow maps, particle textures, etc.
+    tracing::info!("Generating effect textures");
+
+    Ok(())
+}
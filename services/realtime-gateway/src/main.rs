@@ -3,13 +3,16 @@ use std::sync::Arc;
 use std::collections::HashMap;
 use tokio::sync::RwLock;
 use warp::Filter;
-use warp::ws::{WebSocket, Message};
-use futures::{StreamExt, SinkExt};
+use warp::ws::WebSocket;
+use futures::StreamExt;
 use serde::{Deserialize, Serialize};
 use uuid::Uuid;
 use tracing::info;
 use finalverse_logging as logging;
 
+mod outbound;
+use outbound::{Outbound, OutboundHandle};
+
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct ClientMessage {
     pub id: String,
@@ -56,7 +59,7 @@ impl PluginRegistry {
 
 // Client connection manager
 pub struct ConnectionManager {
-    clients: Arc<RwLock<HashMap<String, tokio::sync::mpsc::UnboundedSender<Message>>>>,
+    clients: Arc<RwLock<HashMap<String, OutboundHandle>>>,
 }
 
 impl ConnectionManager {
@@ -66,27 +69,43 @@ impl ConnectionManager {
         }
     }
 
-    pub async fn add_client(&self, client_id: String, tx: tokio::sync::mpsc::UnboundedSender<Message>) {
-        self.clients.write().await.insert(client_id, tx);
+    pub async fn add_client(&self, client_id: String, handle: OutboundHandle) {
+        self.clients.write().await.insert(client_id, handle);
     }
 
     pub async fn remove_client(&self, client_id: &str) {
         self.clients.write().await.remove(client_id);
     }
 
-    pub async fn send_to_client(&self, client_id: &str, message: Message) -> Result<(), String> {
-        let clients = self.clients.read().await;
-        if let Some(tx) = clients.get(client_id) {
-            tx.send(message).map_err(|_| "Failed to send message".to_string())
-        } else {
-            Err("Client not found".to_string())
+    pub async fn send_to_client(&self, client_id: &str, message: Outbound) -> Result<(), String> {
+        let send_result = {
+            let clients = self.clients.read().await;
+            match clients.get(client_id) {
+                Some(handle) => handle.send(message),
+                None => return Err("Client not found".to_string()),
+            }
+        };
+
+        // A full queue means the client can't keep up: drop it rather
+        // than letting its backlog grow
+        if send_result.is_err() {
+            self.remove_client(client_id).await;
+            return Err("Client disconnected (outbound queue full)".to_string());
         }
+        Ok(())
     }
 
-    pub async fn broadcast(&self, message: Message) {
-        let clients = self.clients.read().await;
-        for (_, tx) in clients.iter() {
-            let _ = tx.send(message.clone());
+    pub async fn broadcast(&self, message: ServerMessage) {
+        let lagging: Vec<String> = {
+            let clients = self.clients.read().await;
+            clients
+                .iter()
+                .filter(|(_, handle)| handle.send(outbound::classify(message.clone())).is_err())
+                .map(|(id, _)| id.clone())
+                .collect()
+        };
+        for client_id in lagging {
+            self.remove_client(&client_id).await;
         }
     }
 }
@@ -97,11 +116,12 @@ async fn handle_websocket(
     plugins: Arc<RwLock<PluginRegistry>>,
 ) {
     let client_id = Uuid::new_v4().to_string();
-    let (mut ws_tx, mut ws_rx) = ws.split();
-    let (tx, mut rx) = tokio::sync::mpsc::unbounded_channel();
+    let (ws_tx, mut ws_rx) = ws.split();
 
-    // Add client to connection manager
-    clients.add_client(client_id.clone(), tx).await;
+    // Outbound writer: coalesces per tick, bounded queue, disconnects
+    // clients that can't keep up
+    let handle = outbound::spawn_writer(ws_tx);
+    clients.add_client(client_id.clone(), handle).await;
 
     // Notify plugins of new connection
     {
@@ -111,16 +131,6 @@ async fn handle_websocket(
         }
     }
 
-    // Spawn task to handle outgoing messages
-    let client_id_clone = client_id.clone();
-    tokio::spawn(async move {
-        while let Some(msg) = rx.recv().await {
-            if ws_tx.send(msg).await.is_err() {
-                break;
-            }
-        }
-    });
-
     // Handle incoming messages
     while let Some(result) = ws_rx.next().await {
         match result {
@@ -131,8 +141,9 @@ async fn handle_websocket(
                         let registry = plugins.read().await;
                         for (_, plugin) in &registry.plugins {
                             if let Some(response) = plugin.handle_message(&client_id, client_msg.clone()).await {
-                                let response_text = serde_json::to_string(&response).unwrap();
-                                let _ = clients.send_to_client(&client_id, Message::text(response_text)).await;
+                                let _ = clients
+                                    .send_to_client(&client_id, outbound::classify(response))
+                                    .await;
                             }
                         }
                     }
@@ -0,0 +1,123 @@
+// services/realtime-gateway/src/outbound.rs
+// Per-client outbound stage. Messages are queued on a bounded channel and
+// a writer task flushes them once per tick as a single frame: keyed state
+// updates keep only the latest value per key, ordered events are kept
+// verbatim. A client whose queue fills up is disconnected instead of
+// growing server memory.
+use crate::ServerMessage;
+use futures::stream::SplitSink;
+use futures::SinkExt;
+use std::collections::HashMap;
+use std::time::Duration;
+use tokio::sync::mpsc;
+use tracing::warn;
+use warp::ws::{Message, WebSocket};
+
+/// Messages a client may fall behind by before we drop the connection.
+pub const OUTBOUND_QUEUE_DEPTH: usize = 256;
+/// Outbound flush cadence — everything queued within a tick leaves in
+/// one frame.
+pub const FLUSH_INTERVAL: Duration = Duration::from_millis(50);
+
+#[derive(Debug)]
+pub enum Outbound {
+    /// Delivered in order, never dropped (chat, quest completion, ...).
+    Event(ServerMessage),
+    /// Superseded by any later message with the same key within a tick
+    /// (latest position per entity, latest harmony per region, ...).
+    State { key: String, message: ServerMessage },
+}
+
+/// Route a plugin response to the right coalescing class: payloads that
+/// carry an `entity_id` are per-entity state where only the newest value
+/// matters, everything else is an ordered event.
+pub fn classify(response: ServerMessage) -> Outbound {
+    match response.payload.get("entity_id").and_then(|v| v.as_str()) {
+        Some(id) => Outbound::State {
+            key: format!("{}:{}", response.event, id),
+            message: response,
+        },
+        None => Outbound::Event(response),
+    }
+}
+
+#[derive(Clone)]
+pub struct OutboundHandle {
+    tx: mpsc::Sender<Outbound>,
+}
+
+impl OutboundHandle {
+    /// Queue a message. `Err` means the client is gone or cannot keep up
+    /// — the caller should remove it.
+    pub fn send(&self, message: Outbound) -> Result<(), ()> {
+        self.tx.try_send(message).map_err(|e| {
+            if matches!(e, mpsc::error::TrySendError::Full(_)) {
+                warn!("outbound queue full, disconnecting slow client");
+            }
+        })
+    }
+}
+
+/// Spawn the writer task for one client. Dropping every `OutboundHandle`
+/// ends the task, which closes the socket after a final flush.
+pub fn spawn_writer(mut ws_tx: SplitSink<WebSocket, Message>) -> OutboundHandle {
+    let (tx, mut rx) = mpsc::channel(OUTBOUND_QUEUE_DEPTH);
+
+    tokio::spawn(async move {
+        let mut ticker = tokio::time::interval(FLUSH_INTERVAL);
+        ticker.set_missed_tick_behavior(tokio::time::MissedTickBehavior::Skip);
+
+        let mut events: Vec<ServerMessage> = Vec::new();
+        let mut states: HashMap<String, ServerMessage> = HashMap::new();
+        let mut open = true;
+
+        while open {
+            tokio::select! {
+                queued = rx.recv() => match queued {
+                    Some(Outbound::Event(message)) => events.push(message),
+                    Some(Outbound::State { key, message }) => {
+                        states.insert(key, message);
+                    }
+                    None => open = false,
+                },
+                _ = ticker.tick() => {
+                    if let Some(frame) = drain_into_frame(&mut events, &mut states) {
+                        if ws_tx.send(frame).await.is_err() {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Final flush for anything queued before the handles were dropped
+        if let Some(frame) = drain_into_frame(&mut events, &mut states) {
+            let _ = ws_tx.send(frame).await;
+        }
+        let _ = ws_tx.send(Message::close()).await;
+    });
+
+    OutboundHandle { tx }
+}
+
+/// Everything from this tick as one text frame: a bare object when only
+/// one message is pending (the pre-coalescing wire format), a JSON array
+/// otherwise. `None` when there is nothing to send.
+fn drain_into_frame(
+    events: &mut Vec<ServerMessage>,
+    states: &mut HashMap<String, ServerMessage>,
+) -> Option<Message> {
+    if events.is_empty() && states.is_empty() {
+        return None;
+    }
+
+    let mut batch: Vec<ServerMessage> = events.drain(..).collect();
+    batch.extend(states.drain().map(|(_, message)| message));
+
+    let text = if batch.len() == 1 {
+        serde_json::to_string(&batch[0])
+    } else {
+        serde_json::to_string(&batch)
+    };
+    text.ok().map(Message::text)
+}
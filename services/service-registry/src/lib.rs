@@ -1,11 +1,12 @@
 // services/service-registry/src/lib.rs
 // Service discovery and registration for Finalverse
 
+use dashmap::DashMap;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
 use std::sync::Arc;
 use std::time::{Duration, Instant};
-use tokio::sync::RwLock;
+use tokio::sync::{broadcast, RwLock};
 use tokio::time::interval;
 
 fn default_instant() -> Instant {
@@ -280,10 +281,21 @@ impl RegistryClient {
     }
 }
 
+/// A topology change pushed to subscribers when an endpoint is registered,
+/// re-registered at a new address, or removed.
+#[derive(Debug, Clone)]
+pub enum ServiceChange {
+    Updated { name: String, url: Arc<String> },
+    Removed { name: String },
+}
+
 // For local development without external registry
 #[derive(Clone)]
 pub struct LocalServiceRegistry {
-    services: Arc<RwLock<HashMap<String, String>>>,
+    // Sharded map: resolution is a plain read with no async round trip and
+    // no global lock, cheap enough for the path of every request
+    services: Arc<DashMap<String, Arc<String>>>,
+    changes: broadcast::Sender<ServiceChange>,
 }
 
 impl Default for LocalServiceRegistry {
@@ -294,33 +306,112 @@ impl Default for LocalServiceRegistry {
 
 impl LocalServiceRegistry {
     pub fn new() -> Self {
-        let mut services = HashMap::new();
-        
+        let services = DashMap::new();
+
         // Pre-populate with known services for local development
-        services.insert("song-engine".to_string(), "http://localhost:3001".to_string());
-        services.insert("world-engine".to_string(), "http://localhost:3002".to_string());
-        services.insert("echo-engine".to_string(), "http://localhost:3003".to_string());
-        services.insert("ai-orchestra".to_string(), "http://localhost:3004".to_string());
-        services.insert("story-engine".to_string(), "http://localhost:3005".to_string());
-        services.insert("harmony-service".to_string(), "http://localhost:3006".to_string());
-        services.insert("asset-service".to_string(), "http://localhost:3007".to_string());
-        services.insert("community".to_string(), "http://localhost:3008".to_string());
-        services.insert("silence-service".to_string(), "http://localhost:3009".to_string());
-        services.insert("procedural-gen".to_string(), "http://localhost:3010".to_string());
-        services.insert("behavior-ai".to_string(), "http://localhost:3011".to_string());
-        
+        let defaults = [
+            ("song-engine", "http://localhost:3001"),
+            ("world-engine", "http://localhost:3002"),
+            ("echo-engine", "http://localhost:3003"),
+            ("ai-orchestra", "http://localhost:3004"),
+            ("story-engine", "http://localhost:3005"),
+            ("harmony-service", "http://localhost:3006"),
+            ("asset-service", "http://localhost:3007"),
+            ("community", "http://localhost:3008"),
+            ("silence-service", "http://localhost:3009"),
+            ("procedural-gen", "http://localhost:3010"),
+            ("behavior-ai", "http://localhost:3011"),
+        ];
+        for (name, url) in defaults {
+            services.insert(name.to_string(), Arc::new(url.to_string()));
+        }
+
+        let (changes, _) = broadcast::channel(64);
         Self {
-            services: Arc::new(RwLock::new(services)),
+            services: Arc::new(services),
+            changes,
         }
     }
-    
+
+    /// Resolve a service endpoint. Synchronous and allocation-free on hit —
+    /// the Arc is cloned, not the URL.
+    pub fn resolve(&self, service_name: &str) -> Option<Arc<String>> {
+        self.services.get(service_name).map(|e| e.value().clone())
+    }
+
     pub async fn get_service_url(&self, service_name: &str) -> Option<String> {
-        let services = self.services.read().await;
-        services.get(service_name).cloned()
+        self.resolve(service_name).map(|url| (*url).clone())
     }
-    
+
+    /// Subscribe to topology changes. Receivers see every update made after
+    /// the subscription, so a caller holding resolved endpoints can refresh
+    /// them without polling.
+    pub fn subscribe(&self) -> broadcast::Receiver<ServiceChange> {
+        self.changes.subscribe()
+    }
+
     pub async fn register_service(&self, name: String, url: String) {
-        let mut services = self.services.write().await;
-        services.insert(name, url);
+        let url = Arc::new(url);
+        let unchanged = self
+            .services
+            .get(&name)
+            .map_or(false, |existing| *existing.value() == url);
+        if unchanged {
+            return;
+        }
+
+        self.services.insert(name.clone(), url.clone());
+        let _ = self.changes.send(ServiceChange::Updated { name, url });
+    }
+
+    pub async fn remove_service(&self, name: &str) {
+        if self.services.remove(name).is_some() {
+            let _ = self.changes.send(ServiceChange::Removed {
+                name: name.to_string(),
+            });
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[tokio::test]
+    async fn test_resolution_is_cached_and_updated_by_notification() {
+        let registry = LocalServiceRegistry::new();
+        let mut changes = registry.subscribe();
+
+        assert_eq!(
+            registry.resolve("song-engine").unwrap().as_str(),
+            "http://localhost:3001"
+        );
+
+        registry
+            .register_service("song-engine".to_string(), "http://localhost:4001".to_string())
+            .await;
+
+        match changes.recv().await.unwrap() {
+            ServiceChange::Updated { name, url } => {
+                assert_eq!(name, "song-engine");
+                assert_eq!(url.as_str(), "http://localhost:4001");
+            }
+            other => panic!("unexpected change: {:?}", other),
+        }
+        assert_eq!(
+            registry.resolve("song-engine").unwrap().as_str(),
+            "http://localhost:4001"
+        );
+
+        // Re-registering the same URL must not spam subscribers
+        registry
+            .register_service("song-engine".to_string(), "http://localhost:4001".to_string())
+            .await;
+        registry.remove_service("song-engine").await;
+        assert!(matches!(
+            changes.recv().await.unwrap(),
+            ServiceChange::Removed { .. }
+        ));
+        assert!(registry.resolve("song-engine").is_none());
     }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@ use serde::{Deserialize, Serialize};
 use warp::Filter;
 use tracing::info;
 use finalverse_logging as logging;
+mod quest_system;
 use finalverse_audio_core::{AudioEvent, AudioEventType, AudioSource, EmotionalState};
 use redis::Client as RedisClient;
 use uuid::Uuid;
@@ -14,8 +15,9 @@ use serde_json;
 use finalverse_events::{
     GameEventBus, LocalEventBus, NatsEventBus,
     Event, EventType, SongEvent, SongType, PlayerId, Coordinates,
-    HarmonyEvent, EventMetadata,
+    HarmonyEvent, EventMetadata, WorldEvent, RegionChange,
 };
+use quest_system::QuestRegistry;
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct ActiveSong {
@@ -63,6 +65,7 @@ pub struct DialogueResponse {
 pub struct StoryEngineService {
     active_songs: Arc<RwLock<HashMap<String, ActiveSong>>>,
     symphonies: Arc<RwLock<HashMap<String, Symphony>>>,
+    quests: Arc<RwLock<QuestRegistry>>,
     event_bus: Arc<dyn GameEventBus>,
     subscription_ids: Arc<RwLock<Vec<String>>>,
     redis_client: RedisClient,
@@ -73,6 +76,7 @@ impl StoryEngineService {
         Self {
             active_songs: Arc::new(RwLock::new(HashMap::new())),
             symphonies: Arc::new(RwLock::new(HashMap::new())),
+            quests: Arc::new(RwLock::new(QuestRegistry::new())),
             event_bus,
             subscription_ids: Arc::new(RwLock::new(Vec::new())),
             redis_client,
@@ -134,6 +138,44 @@ impl StoryEngineService {
 
         self.subscription_ids.write().await.push(harmony_sub_id);
 
+        // Route world events to quests through the registry indexes, so
+        // dispatch only ever looks at quests indexed under the affected
+        // region or the event's objective kinds
+        let quests = self.quests.clone();
+
+        let world_sub_id = self
+            .event_bus
+            .subscribe("events.world", Box::new(move |event| {
+                let quests = quests.clone();
+
+                tokio::spawn(async move {
+                    if let EventType::World(WorldEvent::RegionChanged { region_id, change }) = &event.event_type {
+                        let (quest_event_type, severity) = match change {
+                            RegionChange::HarmonyIncreased(amount) => ("harmony_restored", *amount as f32),
+                            RegionChange::DiscordIncreased(amount) => ("harmony_crisis", *amount as f32),
+                            RegionChange::TerrainChanged(_) => ("region_changed", 0.0),
+                        };
+                        let quest_event = quest_system::WorldEvent {
+                            event_id: event.id.clone(),
+                            event_type: quest_event_type.to_string(),
+                            affected_regions: vec![region_id.clone()],
+                            severity,
+                        };
+
+                        let registry = quests.read().await;
+                        for quest in registry.quests_matching_event(&quest_event) {
+                            info!(
+                                "📜 Quest '{}' can advance on {} in region {}",
+                                quest.title, quest_event.event_type, region_id.0
+                            );
+                        }
+                    }
+                });
+            }))
+            .await?;
+
+        self.subscription_ids.write().await.push(world_sub_id);
+
         // Start cleanup task for expired songs
         let songs = self.active_songs.clone();
         tokio::spawn(async move {
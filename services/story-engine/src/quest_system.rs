@@ -3,7 +3,10 @@
 
 use finalverse_core::*;
 use serde::{Deserialize, Serialize};
-use std::collections::HashMap;
+use std::collections::{HashMap, HashSet};
+// The glob above pulls in finalverse_core's `Result<T>` alias; quest
+// generation reports plain String errors, so keep std's Result in scope
+use std::result::Result;
 use uuid::Uuid;
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -211,7 +214,7 @@ impl QuestGenerationEngine {
         player_profile: &PlayerProfile,
         context: &GenerationContext,
     ) -> Result<DynamicQuest, String> {
-        match context.generation_type {
+        match &context.generation_type {
             GenerationType::Template { template_id } => {
                 self.generate_from_template(template_id, player_profile, context).await
             }
@@ -788,6 +791,250 @@ impl QuestGenerationEngine {
     }
 }
 
+/// Coarse discriminant of `ObjectiveType`, used as the key of the inverted
+/// objective index. Adding a variant to `ObjectiveType` requires adding its
+/// kind here and in `ObjectiveType::kind`.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
+pub enum ObjectiveKind {
+    ReachLocation,
+    ExploreArea,
+    InteractWithEcho,
+    TalkToNPC,
+    PerformMelody,
+    RestoreHarmony,
+    CollectItems,
+    GatherPlayers,
+    TeachMelody,
+    SurviveTime,
+    CompleteBeforeTime,
+}
+
+impl ObjectiveKind {
+    /// Which objective kinds a world event of the given type could advance.
+    /// This is the dispatch table that turns event matching into hash
+    /// lookups instead of prerequisite scans.
+    pub fn for_event_type(event_type: &str) -> &'static [ObjectiveKind] {
+        match event_type {
+            "harmony_changed" | "harmony_restored" | "harmony_crisis" => {
+                &[ObjectiveKind::RestoreHarmony]
+            }
+            "player_moved" | "location_reached" => {
+                &[ObjectiveKind::ReachLocation, ObjectiveKind::ExploreArea]
+            }
+            "melody_performed" => &[ObjectiveKind::PerformMelody, ObjectiveKind::TeachMelody],
+            "item_collected" => &[ObjectiveKind::CollectItems],
+            "echo_interaction" => &[ObjectiveKind::InteractWithEcho],
+            "npc_dialogue" => &[ObjectiveKind::TalkToNPC],
+            "players_gathered" | "player_convergence" => &[ObjectiveKind::GatherPlayers],
+            "time_elapsed" => &[ObjectiveKind::SurviveTime, ObjectiveKind::CompleteBeforeTime],
+            _ => &[],
+        }
+    }
+}
+
+impl ObjectiveType {
+    pub fn kind(&self) -> ObjectiveKind {
+        match self {
+            ObjectiveType::ReachLocation { .. } => ObjectiveKind::ReachLocation,
+            ObjectiveType::ExploreArea { .. } => ObjectiveKind::ExploreArea,
+            ObjectiveType::InteractWithEcho { .. } => ObjectiveKind::InteractWithEcho,
+            ObjectiveType::TalkToNPC { .. } => ObjectiveKind::TalkToNPC,
+            ObjectiveType::PerformMelody { .. } => ObjectiveKind::PerformMelody,
+            ObjectiveType::RestoreHarmony { .. } => ObjectiveKind::RestoreHarmony,
+            ObjectiveType::CollectItems { .. } => ObjectiveKind::CollectItems,
+            ObjectiveType::GatherPlayers { .. } => ObjectiveKind::GatherPlayers,
+            ObjectiveType::TeachMelody { .. } => ObjectiveKind::TeachMelody,
+            ObjectiveType::SurviveTime { .. } => ObjectiveKind::SurviveTime,
+            ObjectiveType::CompleteBeforeTime { .. } => ObjectiveKind::CompleteBeforeTime,
+        }
+    }
+
+    fn region_id(&self) -> Option<&RegionId> {
+        match self {
+            ObjectiveType::ExploreArea { region_id, .. } => Some(region_id),
+            ObjectiveType::RestoreHarmony { region_id, .. } => Some(region_id),
+            _ => None,
+        }
+    }
+}
+
+impl DynamicQuest {
+    fn is_live(&self) -> bool {
+        matches!(self.state, QuestState::Available | QuestState::Active { .. })
+    }
+
+    fn participants(&self) -> &[PlayerId] {
+        match &self.state {
+            QuestState::Active { participants, .. } => participants,
+            _ => &[],
+        }
+    }
+
+    fn regions(&self) -> Vec<RegionId> {
+        let mut regions: Vec<RegionId> = self
+            .objectives
+            .iter()
+            .filter_map(|o| o.objective_type.region_id().cloned())
+            .collect();
+        if let QuestType::WorldEvent { affected_regions } = &self.quest_type {
+            regions.extend(affected_regions.iter().cloned());
+        }
+        regions.dedup();
+        regions
+    }
+}
+
+/// Store of live quests with incrementally maintained secondary indexes.
+/// Lookups by player, by region, and by the objective kinds an event could
+/// advance are all hash lookups; nothing iterates every quest. Quests in a
+/// terminal state are dropped from the region and objective indexes, so the
+/// hot event-matching path only ever sees quests that can still progress.
+#[derive(Debug, Default)]
+pub struct QuestRegistry {
+    quests: HashMap<Uuid, DynamicQuest>,
+    by_player: HashMap<PlayerId, HashSet<Uuid>>,
+    by_region: HashMap<RegionId, HashSet<Uuid>>,
+    by_objective_kind: HashMap<ObjectiveKind, HashSet<Uuid>>,
+}
+
+impl QuestRegistry {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn insert(&mut self, quest: DynamicQuest) {
+        let id = quest.id;
+        self.unindex(id);
+        self.index(&quest);
+        self.quests.insert(id, quest);
+    }
+
+    pub fn remove(&mut self, id: Uuid) -> Option<DynamicQuest> {
+        self.unindex(id);
+        self.quests.remove(&id)
+    }
+
+    pub fn get(&self, id: Uuid) -> Option<&DynamicQuest> {
+        self.quests.get(&id)
+    }
+
+    /// Transition a quest's state, keeping the indexes in sync (new
+    /// participants are indexed, terminal quests leave the event indexes).
+    pub fn set_state(&mut self, id: Uuid, state: QuestState) {
+        // Unindex while the quest is still stored, so the old buckets can
+        // be derived from it
+        self.unindex(id);
+        let Some(mut quest) = self.quests.remove(&id) else {
+            return;
+        };
+        quest.state = state;
+        self.index(&quest);
+        self.quests.insert(id, quest);
+    }
+
+    pub fn quests_for_player(&self, player_id: &PlayerId) -> Vec<&DynamicQuest> {
+        self.collect(self.by_player.get(player_id))
+    }
+
+    pub fn quests_in_region(&self, region_id: &RegionId) -> Vec<&DynamicQuest> {
+        self.collect(self.by_region.get(region_id))
+    }
+
+    /// Quests that could advance on this event: the union of the event's
+    /// affected regions and the objective kinds its type maps to.
+    pub fn quests_matching_event(&self, event: &WorldEvent) -> Vec<&DynamicQuest> {
+        let mut ids: HashSet<Uuid> = HashSet::new();
+        for region_id in &event.affected_regions {
+            if let Some(set) = self.by_region.get(region_id) {
+                ids.extend(set);
+            }
+        }
+        for kind in ObjectiveKind::for_event_type(&event.event_type) {
+            if let Some(set) = self.by_objective_kind.get(kind) {
+                ids.extend(set);
+            }
+        }
+        ids.into_iter().filter_map(|id| self.quests.get(&id)).collect()
+    }
+
+    pub fn len(&self) -> usize {
+        self.quests.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.quests.is_empty()
+    }
+
+    fn index(&mut self, quest: &DynamicQuest) {
+        for player_id in quest.participants() {
+            self.by_player
+                .entry(player_id.clone())
+                .or_default()
+                .insert(quest.id);
+        }
+
+        if !quest.is_live() {
+            return;
+        }
+        for region_id in quest.regions() {
+            self.by_region.entry(region_id).or_default().insert(quest.id);
+        }
+        for objective in &quest.objectives {
+            self.by_objective_kind
+                .entry(objective.objective_type.kind())
+                .or_default()
+                .insert(quest.id);
+        }
+    }
+
+    /// Remove a quest from exactly the buckets it was indexed under,
+    /// derived from the quest itself — O(its participants + regions +
+    /// objectives), never a walk over the whole index. Callers must
+    /// unindex before removing the quest from `quests`.
+    fn unindex(&mut self, id: Uuid) {
+        let Some(quest) = self.quests.get(&id) else {
+            return;
+        };
+        let players: Vec<PlayerId> = quest.participants().to_vec();
+        let regions = quest.regions();
+        let kinds: Vec<ObjectiveKind> = quest
+            .objectives
+            .iter()
+            .map(|o| o.objective_type.kind())
+            .collect();
+
+        for player_id in players {
+            if let Some(set) = self.by_player.get_mut(&player_id) {
+                set.remove(&id);
+                if set.is_empty() {
+                    self.by_player.remove(&player_id);
+                }
+            }
+        }
+        for region_id in regions {
+            if let Some(set) = self.by_region.get_mut(&region_id) {
+                set.remove(&id);
+                if set.is_empty() {
+                    self.by_region.remove(&region_id);
+                }
+            }
+        }
+        for kind in kinds {
+            if let Some(set) = self.by_objective_kind.get_mut(&kind) {
+                set.remove(&id);
+                if set.is_empty() {
+                    self.by_objective_kind.remove(&kind);
+                }
+            }
+        }
+    }
+
+    fn collect(&self, ids: Option<&HashSet<Uuid>>) -> Vec<&DynamicQuest> {
+        ids.map(|set| set.iter().filter_map(|id| self.quests.get(id)).collect())
+            .unwrap_or_default()
+    }
+}
+
 // Supporting types and structures
 #[derive(Debug, Clone)]
 pub struct PlayerProfile {
@@ -893,4 +1140,158 @@ fn calculate_crisis_severity(harmony: f32) -> f32 {
     } else {
         0.4
     }
-}
\ No newline at end of file
+}
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn quest_with(objective_type: ObjectiveType, state: QuestState) -> DynamicQuest {
+        DynamicQuest {
+            id: Uuid::new_v4(),
+            title: "test quest".to_string(),
+            description: String::new(),
+            quest_type: QuestType::Personal {
+                narrative_weight: 0.5,
+            },
+            objectives: vec![DynamicObjective {
+                id: Uuid::new_v4(),
+                description: String::new(),
+                objective_type,
+                progress: ObjectiveProgress::NotStarted,
+                hidden: false,
+                optional: false,
+            }],
+            prerequisites: QuestPrerequisites {
+                min_resonance: None,
+                required_quests: vec![],
+                required_echo_bonds: HashMap::new(),
+                region_harmony: None,
+            },
+            rewards: QuestRewards {
+                resonance: Resonance {
+                    creative: 0,
+                    exploration: 0,
+                    restoration: 0,
+                },
+                items: vec![],
+                unlocks: vec![],
+                narrative_impact: NarrativeImpact {
+                    world_state_changes: HashMap::new(),
+                    relationship_changes: HashMap::new(),
+                    legend_entry: None,
+                },
+            },
+            context: QuestContext {
+                generated_by: QuestGenerator::System {
+                    template_id: "test".to_string(),
+                },
+                narrative_tags: vec![],
+                difficulty_rating: 1.0,
+                estimated_duration: 10,
+            },
+            state,
+            created_at: chrono::Utc::now(),
+            expires_at: None,
+        }
+    }
+
+    fn harmony_event(region_id: RegionId) -> WorldEvent {
+        WorldEvent {
+            event_id: "evt".to_string(),
+            event_type: "harmony_changed".to_string(),
+            affected_regions: vec![region_id],
+            severity: 0.5,
+        }
+    }
+
+    #[test]
+    fn test_event_matching_uses_region_and_kind_indexes() {
+        let region = RegionId(Uuid::new_v4());
+        let other_region = RegionId(Uuid::new_v4());
+        let mut registry = QuestRegistry::new();
+
+        let harmony_quest = quest_with(
+            ObjectiveType::RestoreHarmony {
+                region_id: region.clone(),
+                target_level: 0.8,
+            },
+            QuestState::Available,
+        );
+        let harmony_id = harmony_quest.id;
+        registry.insert(harmony_quest);
+        registry.insert(quest_with(
+            ObjectiveType::CollectItems {
+                item_type: "crystal".to_string(),
+                quantity: 3,
+            },
+            QuestState::Available,
+        ));
+
+        // Matched through both the region and objective-kind indexes,
+        // but returned once; the collect quest never matches
+        let matched = registry.quests_matching_event(&harmony_event(region.clone()));
+        assert_eq!(matched.len(), 1);
+        assert_eq!(matched[0].id, harmony_id);
+
+        // An unrelated region still matches on objective kind alone
+        let matched = registry.quests_matching_event(&harmony_event(other_region));
+        assert_eq!(matched.len(), 1);
+    }
+
+    #[test]
+    fn test_terminal_state_leaves_event_indexes() {
+        let region = RegionId(Uuid::new_v4());
+        let mut registry = QuestRegistry::new();
+        let quest = quest_with(
+            ObjectiveType::RestoreHarmony {
+                region_id: region.clone(),
+                target_level: 0.8,
+            },
+            QuestState::Available,
+        );
+        let id = quest.id;
+        registry.insert(quest);
+        assert_eq!(registry.quests_matching_event(&harmony_event(region.clone())).len(), 1);
+
+        registry.set_state(
+            id,
+            QuestState::Completed {
+                completed_at: chrono::Utc::now(),
+                completion_style: CompletionStyle::Standard,
+            },
+        );
+        assert!(registry.quests_matching_event(&harmony_event(region.clone())).is_empty());
+        assert_eq!(registry.len(), 1);
+
+        registry.remove(id);
+        assert!(registry.is_empty());
+    }
+
+    #[test]
+    fn test_participant_index_follows_state_transitions() {
+        let player = PlayerId(Uuid::new_v4());
+        let mut registry = QuestRegistry::new();
+        let quest = quest_with(
+            ObjectiveType::TalkToNPC {
+                npc_id: "anya".to_string(),
+                dialogue_branch: None,
+            },
+            QuestState::Available,
+        );
+        let id = quest.id;
+        registry.insert(quest);
+        assert!(registry.quests_for_player(&player).is_empty());
+
+        registry.set_state(
+            id,
+            QuestState::Active {
+                started_at: chrono::Utc::now(),
+                participants: vec![player.clone()],
+            },
+        );
+        assert_eq!(registry.quests_for_player(&player).len(), 1);
+
+        registry.set_state(id, QuestState::Expired);
+        assert!(registry.quests_for_player(&player).is_empty());
+    }
+}
@@ -1,11 +1,40 @@
 // services/symphony-engine/src/spatial_audio.rs
 use nalgebra::{Vector3, Point3};
 use std::collections::HashMap;
+use std::sync::Mutex;
+
+/// Samples processed per block by the DSP kernels. Small enough to stay in
+/// L1, large enough for the compiler to vectorize the inner loops.
+pub const AUDIO_BLOCK_SIZE: usize = 256;
+
+/// Pool of scratch buffers so processing a frame of audio allocates once per
+/// source lifetime instead of once per effect stage.
+struct BufferPool {
+    buffers: Mutex<Vec<Vec<f32>>>,
+}
+
+impl BufferPool {
+    fn new() -> Self {
+        Self {
+            buffers: Mutex::new(Vec::new()),
+        }
+    }
+
+    fn acquire(&self) -> Vec<f32> {
+        self.buffers.lock().unwrap().pop().unwrap_or_default()
+    }
+
+    fn release(&self, mut buffer: Vec<f32>) {
+        buffer.clear();
+        self.buffers.lock().unwrap().push(buffer);
+    }
+}
 
 pub struct SpatialAudioEngine {
     listener_position: Point3<f32>,
     listener_orientation: Vector3<f32>,
     sound_sources: HashMap<uuid::Uuid, SpatialSoundSource>,
+    buffer_pool: BufferPool,
 }
 
 impl SpatialAudioEngine {
@@ -14,6 +43,7 @@ impl SpatialAudioEngine {
             listener_position: Point3::origin(),
             listener_orientation: Vector3::z(), // Looking forward
             sound_sources: HashMap::new(),
+            buffer_pool: BufferPool::new(),
         }
     }
 
@@ -35,22 +65,37 @@ impl SpatialAudioEngine {
         source_id: uuid::Uuid,
         audio: Vec<f32>,
     ) -> StereoAudio {
+        let mut output = StereoAudio::default();
+        self.process_3d_audio_into(source_id, &audio, &mut output);
+        output
+    }
+
+    /// Process a frame into caller-provided output buffers. The buffers are
+    /// cleared and refilled, so a caller looping over sources can reuse one
+    /// `StereoAudio` and never reallocate once it has grown to frame size.
+    pub fn process_3d_audio_into(
+        &self,
+        source_id: uuid::Uuid,
+        audio: &[f32],
+        output: &mut StereoAudio,
+    ) {
         if let Some(source) = self.sound_sources.get(&source_id) {
-            self.apply_3d_processing(audio, source)
+            self.apply_3d_processing(audio, source, output);
         } else {
-            // Return mono audio as stereo if source not found
-            StereoAudio {
-                left: audio.clone(),
-                right: audio,
-            }
+            // Pass mono audio through as centered stereo if source not found
+            output.left.clear();
+            output.left.extend_from_slice(audio);
+            output.right.clear();
+            output.right.extend_from_slice(audio);
         }
     }
 
     fn apply_3d_processing(
         &self,
-        audio: Vec<f32>,
+        audio: &[f32],
         source: &SpatialSoundSource,
-    ) -> StereoAudio {
+        output: &mut StereoAudio,
+    ) {
         // Calculate distance and direction
         let direction = source.position - self.listener_position;
         let distance = direction.magnitude();
@@ -62,29 +107,26 @@ impl SpatialAudioEngine {
         // Calculate panning based on direction
         let (left_gain, right_gain) = self.calculate_stereo_panning(normalized_dir);
 
+        // One pooled work buffer holds the frame through every effect stage;
+        // the input is copied exactly once.
+        let mut work = self.buffer_pool.acquire();
+
         // Apply Doppler effect if source is moving
-        let doppler_shifted = if source.velocity.magnitude() > 0.01 {
-            self.apply_doppler_effect(audio.clone(), source, distance)
+        if source.velocity.magnitude() > 0.01 {
+            self.apply_doppler_effect(audio, source, &mut work);
         } else {
-            audio.clone()
-        };
-
-        // Apply environmental effects
-        let processed = self.apply_environmental_effects(
-            doppler_shifted,
-            source,
-            distance,
-        );
-
-        // Create stereo output with panning and attenuation
-        StereoAudio {
-            left: processed.iter()
-                .map(|&s| s * left_gain * attenuation)
-                .collect(),
-            right: processed.iter()
-                .map(|&s| s * right_gain * attenuation)
-                .collect(),
+            work.extend_from_slice(audio);
         }
+
+        // Apply environmental effects in place
+        self.apply_environmental_effects(&mut work, source, distance);
+
+        // Stereo output with panning and attenuation folded into one gain
+        // per channel, applied by the block kernel
+        scale_into(&work, left_gain * attenuation, &mut output.left);
+        scale_into(&work, right_gain * attenuation, &mut output.right);
+
+        self.buffer_pool.release(work);
     }
 
     fn calculate_attenuation(
@@ -132,10 +174,10 @@ impl SpatialAudioEngine {
 
     fn apply_doppler_effect(
         &self,
-        audio: Vec<f32>,
+        audio: &[f32],
         source: &SpatialSoundSource,
-        distance: f32,
-    ) -> Vec<f32> {
+        output: &mut Vec<f32>,
+    ) {
         // Speed of sound in units per second
         const SPEED_OF_SOUND: f32 = 343.0;
 
@@ -147,13 +189,13 @@ impl SpatialAudioEngine {
         let doppler_factor = SPEED_OF_SOUND / (SPEED_OF_SOUND - relative_velocity);
 
         // Resample audio based on Doppler factor
-        self.resample_audio(audio, doppler_factor)
+        self.resample_audio(audio, doppler_factor, output);
     }
 
-    fn resample_audio(&self, audio: Vec<f32>, factor: f32) -> Vec<f32> {
+    fn resample_audio(&self, audio: &[f32], factor: f32, output: &mut Vec<f32>) {
         // Simple linear interpolation resampling
         let output_len = (audio.len() as f32 / factor) as usize;
-        let mut output = Vec::with_capacity(output_len);
+        output.reserve(output_len);
 
         for i in 0..output_len {
             let source_index = i as f32 * factor;
@@ -168,84 +210,81 @@ impl SpatialAudioEngine {
                 output.push(audio[index_floor]);
             }
         }
-
-        output
     }
 
     fn apply_environmental_effects(
         &self,
-        audio: Vec<f32>,
+        audio: &mut [f32],
         source: &SpatialSoundSource,
         distance: f32,
-    ) -> Vec<f32> {
-        let mut processed = audio;
-
+    ) {
         // Apply low-pass filter for distance
         if distance > 10.0 {
-            processed = self.apply_lowpass_filter(processed, 2000.0 / (distance / 10.0));
+            apply_lowpass_filter(audio, 2000.0 / (distance / 10.0));
         }
 
         // Apply reverb based on environment
         if source.environment.reverb > 0.0 {
-            processed = self.apply_environmental_reverb(
-                processed,
-                &source.environment,
-            );
+            apply_environmental_reverb(audio, &source.environment);
         }
 
         // Apply occlusion
         if source.occlusion > 0.0 {
-            processed = self.apply_occlusion(processed, source.occlusion);
+            apply_occlusion(audio, source.occlusion);
         }
+    }
+}
 
-        processed
+/// Multiply `src` by a constant gain into `dst`, block by block. The fixed
+/// block size gives the compiler a simple countable inner loop to vectorize.
+fn scale_into(src: &[f32], gain: f32, dst: &mut Vec<f32>) {
+    dst.clear();
+    dst.reserve(src.len());
+    for block in src.chunks(AUDIO_BLOCK_SIZE) {
+        dst.extend(block.iter().map(|&s| s * gain));
     }
+}
 
-    fn apply_lowpass_filter(&self, audio: Vec<f32>, cutoff: f32) -> Vec<f32> {
-        // Simple one-pole lowpass filter
-        let mut output = vec![0.0; audio.len()];
-        let rc = 1.0 / (2.0 * std::f32::consts::PI * cutoff);
-        let dt = 1.0 / 44100.0;
-        let alpha = dt / (rc + dt);
+fn apply_lowpass_filter(audio: &mut [f32], cutoff: f32) {
+    if audio.is_empty() {
+        return;
+    }
 
-        output[0] = audio[0];
-        for i in 1..audio.len() {
-            output[i] = output[i - 1] + alpha * (audio[i] - output[i - 1]);
-        }
+    // Simple one-pole lowpass filter, in place: each output sample only
+    // depends on the previous output and the current input
+    let rc = 1.0 / (2.0 * std::f32::consts::PI * cutoff);
+    let dt = 1.0 / 44100.0;
+    let alpha = dt / (rc + dt);
 
-        output
+    let mut previous = audio[0];
+    for sample in audio.iter_mut().skip(1) {
+        previous += alpha * (*sample - previous);
+        *sample = previous;
     }
+}
 
-    fn apply_environmental_reverb(
-        &self,
-        audio: Vec<f32>,
-        environment: &EnvironmentAcoustics,
-    ) -> Vec<f32> {
-        let mut output = audio.clone();
-
-        // Apply multiple delay taps for reverb
-        let delays = [
-            (0.043, 0.5),  // Early reflection 1
-            (0.067, 0.4),  // Early reflection 2
-            (0.087, 0.3),  // Early reflection 3
-            (0.120, 0.25), // Late reflection 1
-            (0.190, 0.2),  // Late reflection 2
-        ];
-
-        for (delay_time, gain) in delays.iter() {
-            let delay_samples = (delay_time * 44100.0) as usize;
-            for i in delay_samples..output.len() {
-                output[i] += output[i - delay_samples] * gain * environment.reverb;
-            }
+fn apply_environmental_reverb(audio: &mut [f32], environment: &EnvironmentAcoustics) {
+    // Apply multiple delay taps for reverb
+    let delays = [
+        (0.043, 0.5),  // Early reflection 1
+        (0.067, 0.4),  // Early reflection 2
+        (0.087, 0.3),  // Early reflection 3
+        (0.120, 0.25), // Late reflection 1
+        (0.190, 0.2),  // Late reflection 2
+    ];
+
+    for (delay_time, gain) in delays.iter() {
+        let delay_samples = (delay_time * 44100.0) as usize;
+        let feedback = gain * environment.reverb;
+        for i in delay_samples..audio.len() {
+            audio[i] += audio[i - delay_samples] * feedback;
         }
-
-        output
     }
+}
 
-    fn apply_occlusion(&self, audio: Vec<f32>, occlusion: f32) -> Vec<f32> {
-        // Apply more aggressive low-pass filter for occlusion
-        self.apply_lowpass_filter(audio, 1000.0 * (1.0 - occlusion))
-    }
+fn apply_occlusion(audio: &mut [f32], occlusion: f32) {
+    // Apply more aggressive low-pass filter for occlusion
+    apply_lowpass_filter(audio, 1000.0 * (1.0 - occlusion));
 }
 
 pub struct SpatialSoundSource {
@@ -278,7 +317,8 @@ pub struct EnvironmentAcoustics {
     pub absorption: f32,      // High frequency absorption
 }
 
+#[derive(Default)]
 pub struct StereoAudio {
     pub left: Vec<f32>,
     pub right: Vec<f32>,
-}
\ No newline at end of file
+}
@@ -1,12 +1,46 @@
 // services/symphony-engine/src/voice_synthesis.rs
 use finalverse_audio_core::*;
 use crate::audio_generator::{AudioStream, AudioFormat, AudioMetadata};
+use lru::LruCache;
 use std::collections::HashMap;
-use tokio::sync::RwLock;
+use std::collections::hash_map::DefaultHasher;
+use std::hash::{Hash, Hasher};
+use std::num::NonZeroUsize;
+use std::sync::Arc;
+use tokio::sync::{mpsc, Mutex, RwLock};
+
+/// Synthesized lines kept in the cache. Echo dialogue repeats the same lines
+/// constantly during the first hour, so hit rates are high even at this size.
+const VOICE_CACHE_CAPACITY: usize = 256;
+
+/// Samples per chunk on the streaming path (~1/10s at 44.1kHz).
+const VOICE_CHUNK_SAMPLES: usize = 4096;
+
+/// Cache key: which voice said what. Emotion is part of the key because it
+/// adjusts the voice profile before synthesis.
+#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+struct VoiceCacheKey {
+    character_id: String,
+    emotion: String,
+    text_hash: u64,
+}
+
+impl VoiceCacheKey {
+    fn new(character_id: &str, emotion: &EmotionalState, text: &str) -> Self {
+        let mut hasher = DefaultHasher::new();
+        text.hash(&mut hasher);
+        Self {
+            character_id: character_id.to_string(),
+            emotion: format!("{:?}", emotion),
+            text_hash: hasher.finish(),
+        }
+    }
+}
 
 pub struct VoiceSynthesizer {
     voice_profiles: RwLock<HashMap<String, VoiceProfile>>,
     tts_engine: TTSEngine,
+    voice_cache: Mutex<LruCache<VoiceCacheKey, Arc<Vec<f32>>>>,
 }
 
 impl VoiceSynthesizer {
@@ -81,6 +115,9 @@ impl VoiceSynthesizer {
         Self {
             voice_profiles: RwLock::new(voice_profiles),
             tts_engine: TTSEngine::new(),
+            voice_cache: Mutex::new(LruCache::new(
+                NonZeroUsize::new(VOICE_CACHE_CAPACITY).unwrap(),
+            )),
         }
     }
 
@@ -91,6 +128,122 @@ impl VoiceSynthesizer {
         emotion: EmotionalState,
         context: DialogueContext,
     ) -> Result<AudioStream, Box<dyn std::error::Error>> {
+        let key = VoiceCacheKey::new(character_id, &emotion, text);
+
+        // Cache hit: the line has been synthesized before, reuse the audio
+        if let Some(audio) = self.voice_cache.lock().await.get(&key) {
+            return Ok(self.stream_from_audio(character_id, text, audio.as_ref().clone()));
+        }
+
+        let processed_audio = self
+            .synthesize_uncached(character_id, text, emotion, &context)
+            .await?;
+
+        self.voice_cache
+            .lock()
+            .await
+            .put(key, Arc::new(processed_audio.clone()));
+
+        Ok(self.stream_from_audio(character_id, text, processed_audio))
+    }
+
+    /// Streaming variant: returns a channel that yields audio in
+    /// VOICE_CHUNK_SAMPLES chunks. Cache hits start streaming immediately;
+    /// on a miss the chunks flow as each phoneme is synthesized, so playback
+    /// can begin before the whole line is done.
+    pub async fn synthesize_dialogue_streaming(
+        self: Arc<Self>,
+        character_id: &str,
+        text: &str,
+        emotion: EmotionalState,
+        context: DialogueContext,
+    ) -> Result<mpsc::Receiver<Vec<f32>>, Box<dyn std::error::Error>> {
+        let key = VoiceCacheKey::new(character_id, &emotion, text);
+        let (tx, rx) = mpsc::channel(8);
+
+        if let Some(audio) = self.voice_cache.lock().await.get(&key) {
+            let audio = audio.clone();
+            tokio::spawn(async move {
+                for chunk in audio.chunks(VOICE_CHUNK_SAMPLES) {
+                    if tx.send(chunk.to_vec()).await.is_err() {
+                        return;
+                    }
+                }
+            });
+            return Ok(rx);
+        }
+
+        let profiles = self.voice_profiles.read().await;
+        let profile = profiles.get(character_id)
+            .ok_or("Character voice profile not found")?;
+        let adjusted_profile = self.adjust_for_emotion(profile, emotion);
+        drop(profiles);
+
+        let phonemes = self.text_to_melodic_phonemes(text, &adjusted_profile, &context);
+        let character_id = character_id.to_string();
+        let synthesizer = self.clone();
+
+        tokio::spawn(async move {
+            let mut complete: Vec<f32> = Vec::new();
+
+            // Synthesize phoneme by phoneme and flush whenever a chunk's
+            // worth of samples is ready
+            let mut pending: Vec<f32> = Vec::new();
+            for phoneme in phonemes {
+                let samples = match synthesizer
+                    .tts_engine
+                    .synthesize(vec![phoneme], adjusted_profile.clone())
+                    .await
+                {
+                    Ok(samples) => samples,
+                    Err(_) => return,
+                };
+                pending.extend_from_slice(&samples);
+
+                while pending.len() >= VOICE_CHUNK_SAMPLES {
+                    let rest = pending.split_off(VOICE_CHUNK_SAMPLES);
+                    let chunk = synthesizer.apply_character_effects(
+                        std::mem::replace(&mut pending, rest),
+                        &character_id,
+                        &adjusted_profile,
+                    );
+                    complete.extend_from_slice(&chunk);
+                    if tx.send(chunk).await.is_err() {
+                        return;
+                    }
+                }
+            }
+
+            if !pending.is_empty() {
+                let chunk = synthesizer.apply_character_effects(
+                    pending,
+                    &character_id,
+                    &adjusted_profile,
+                );
+                complete.extend_from_slice(&chunk);
+                if tx.send(chunk).await.is_err() {
+                    return;
+                }
+            }
+
+            // The finished line goes into the cache for next time
+            synthesizer
+                .voice_cache
+                .lock()
+                .await
+                .put(key, Arc::new(complete));
+        });
+
+        Ok(rx)
+    }
+
+    async fn synthesize_uncached(
+        &self,
+        character_id: &str,
+        text: &str,
+        emotion: EmotionalState,
+        context: &DialogueContext,
+    ) -> Result<Vec<f32>, Box<dyn std::error::Error>> {
         let profiles = self.voice_profiles.read().await;
         let profile = profiles.get(character_id)
             .ok_or("Character voice profile not found")?;
@@ -99,7 +252,7 @@ impl VoiceSynthesizer {
         let adjusted_profile = self.adjust_for_emotion(profile, emotion);
 
         // Convert text to phonemes with melodic inflection
-        let phonemes = self.text_to_melodic_phonemes(text, &adjusted_profile, &context);
+        let phonemes = self.text_to_melodic_phonemes(text, &adjusted_profile, context);
 
         // Generate audio
         let audio_data = self
@@ -108,22 +261,20 @@ impl VoiceSynthesizer {
             .await?;
 
         // Apply character-specific effects
-        let processed_audio = self.apply_character_effects(
-            audio_data,
-            character_id,
-            &adjusted_profile,
-        );
+        Ok(self.apply_character_effects(audio_data, character_id, &adjusted_profile))
+    }
 
-        Ok(AudioStream {
+    fn stream_from_audio(&self, character_id: &str, text: &str, audio: Vec<f32>) -> AudioStream {
+        AudioStream {
             id: uuid::Uuid::new_v4(),
-            data: processed_audio,
+            data: audio,
             format: AudioFormat::default(),
             metadata: AudioMetadata {
                 theme_id: format!("{}_dialogue", character_id),
                 duration: std::time::Duration::from_secs(text.len() as u64 / 10), // Rough estimate
                 loop_point: None,
             },
-        })
+        }
     }
 
     fn adjust_for_emotion(&self, base_profile: &VoiceProfile, emotion: EmotionalState) -> VoiceProfile {
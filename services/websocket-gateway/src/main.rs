@@ -1,7 +1,7 @@
 use axum::{
     extract::{
         ws::{Message, WebSocket, WebSocketUpgrade},
-        State,
+        Query, State,
     },
     http::StatusCode,
     response::{IntoResponse, Json},
@@ -12,6 +12,7 @@ use finalverse_core::{
     events::{FinalverseEvent, HarmonyEvent, SongEvent},
     types::{Coordinates, EchoId, Melody, PlayerId, RegionId},
 };
+use dashmap::DashMap;
 use futures::{stream::SplitSink, stream::SplitStream, SinkExt, StreamExt};
 use serde::{Deserialize, Serialize};
 use tracing::info;
@@ -19,7 +20,7 @@ use finalverse_logging as logging;
 use std::{
     collections::HashMap,
     net::SocketAddr,
-    sync::{Arc, RwLock},
+    sync::Arc,
 };
 use tokio::sync::mpsc;
 use tower::ServiceBuilder;
@@ -57,26 +58,66 @@ pub enum WSMessage {
     },
 }
 
-#[derive(Debug, Clone)]
+/// Wire encoding for a client connection, negotiated at upgrade time via the
+/// `?format=binary` query parameter. JSON stays the default so existing
+/// clients (txtViewer) keep working unchanged.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum WireFormat {
+    #[default]
+    Json,
+    Binary,
+}
+
+impl WireFormat {
+    fn from_params(params: &HashMap<String, String>) -> Self {
+        match params.get("format").map(String::as_str) {
+            Some("binary") => WireFormat::Binary,
+            _ => WireFormat::Json,
+        }
+    }
+}
+
+/// Encode a message once for the given wire format. Broadcast paths call
+/// this per format (not per client) and share the resulting frame.
+fn encode_ws_message(message: &WSMessage, format: WireFormat) -> Option<Message> {
+    match format {
+        WireFormat::Json => serde_json::to_string(message).ok().map(Message::Text),
+        WireFormat::Binary => bincode::serialize(message).ok().map(Message::Binary),
+    }
+}
+
+fn decode_ws_message(message: &Message) -> Option<WSMessage> {
+    match message {
+        Message::Text(text) => serde_json::from_str(text).ok(),
+        Message::Binary(bytes) => bincode::deserialize(bytes).ok(),
+        _ => None,
+    }
+}
+
+/// Session state sharded by player id (DashMap partitions keys across
+/// independent locks), with harmony levels in their own structure, so
+/// connection handling and broadcast never contend on one global lock.
+#[derive(Debug)]
 pub struct GameState {
-    players: HashMap<PlayerId, PlayerSession>,
-    harmony_levels: HashMap<RegionId, f32>,
+    players: DashMap<PlayerId, PlayerSession>,
+    harmony_levels: DashMap<RegionId, f32>,
 }
 
 #[derive(Debug, Clone)]
 pub struct PlayerSession {
     player_id: PlayerId,
     current_region: RegionId,
-    sender: Option<mpsc::UnboundedSender<WSMessage>>,
+    wire_format: WireFormat,
+    sender: Option<mpsc::UnboundedSender<Message>>,
 }
 
-type SharedGameState = Arc<RwLock<GameState>>;
+type SharedGameState = Arc<GameState>;
 
 impl GameState {
     pub fn new() -> Self {
         Self {
-            players: HashMap::new(),
-            harmony_levels: HashMap::new(),
+            players: DashMap::new(),
+            harmony_levels: DashMap::new(),
         }
     }
 }
@@ -90,76 +131,75 @@ struct ServiceInfo {
 
 pub async fn websocket_handler(
     ws: WebSocketUpgrade,
+    Query(params): Query<HashMap<String, String>>,
     State(state): State<SharedGameState>,
 ) -> impl IntoResponse {
-    ws.on_upgrade(move |socket| handle_websocket(socket, state))
+    let wire_format = WireFormat::from_params(&params);
+    ws.on_upgrade(move |socket| handle_websocket(socket, state, wire_format))
 }
 
-async fn handle_websocket(socket: WebSocket, state: SharedGameState) {
+async fn handle_websocket(socket: WebSocket, state: SharedGameState, wire_format: WireFormat) {
     let (sender, receiver) = socket.split();
     let (tx, mut rx) = mpsc::unbounded_channel();
 
     // Generate a unique player ID
     let player_id = PlayerId(Uuid::new_v4());
 
-    // Add player to game state
-    {
-        let mut game_state = state.write().unwrap();
-        game_state.players.insert(
-            player_id.clone(),
-            PlayerSession {
-                player_id: player_id.clone(),
-                current_region: RegionId(Uuid::new_v4()),
-                sender: Some(tx.clone()),
-            },
-        );
-    }
+    // Add player to game state (only the owning shard is locked)
+    state.players.insert(
+        player_id.clone(),
+        PlayerSession {
+            player_id: player_id.clone(),
+            current_region: RegionId(Uuid::new_v4()),
+            wire_format,
+            sender: Some(tx.clone()),
+        },
+    );
 
     // Send connection confirmation
-    let _ = tx.send(WSMessage::Connected {
+    let connected = WSMessage::Connected {
         player_id: player_id.clone(),
-    });
+    };
+    if let Some(frame) = encode_ws_message(&connected, wire_format) {
+        let _ = tx.send(frame);
+    }
 
-    // Spawn task to handle outgoing messages
+    // Spawn task to handle outgoing messages (frames arrive pre-encoded)
     let mut sender = sender;
     tokio::spawn(async move {
-        while let Some(msg) = rx.recv().await {
-            if let Ok(json_msg) = serde_json::to_string(&msg) {
-                if sender.send(Message::Text(json_msg)).await.is_err() {
-                    break;
-                }
+        while let Some(frame) = rx.recv().await {
+            if sender.send(frame).await.is_err() {
+                break;
             }
         }
     });
 
-    // Handle incoming messages
+    // Handle incoming messages in either encoding
     let mut receiver = receiver;
     while let Some(msg) = receiver.next().await {
         match msg {
-            Ok(Message::Text(text)) => {
-                if let Ok(ws_message) = serde_json::from_str::<WSMessage>(&text) {
-                    handle_message(ws_message, &state, &player_id, &tx).await;
-                }
-            }
             Ok(Message::Close(_)) => {
                 break;
             }
+            Ok(msg) => {
+                if let Some(ws_message) = decode_ws_message(&msg) {
+                    handle_message(ws_message, &state, &player_id, wire_format, &tx).await;
+                }
+            }
             _ => {}
         }
     }
 
     // Remove player from state when disconnected
-    {
-        let mut game_state = state.write().unwrap();
-        game_state.players.remove(&player_id);
-    }
+    state.players.remove(&player_id);
 }
 
 async fn handle_message(
     message: WSMessage,
     state: &SharedGameState,
     player_id: &PlayerId,
-    tx: &mpsc::UnboundedSender<WSMessage>,
+    wire_format: WireFormat,
+    tx: &mpsc::UnboundedSender<Message>,
 ) {
     match message {
         WSMessage::SongweavingPerformed { melody, target } => {
@@ -182,10 +222,13 @@ async fn handle_message(
             broadcast_harmony_update(state, &RegionId(Uuid::new_v4()), 0.75).await;
 
             // Send confirmation to player
-            let _ = tx.send(WSMessage::WorldUpdate {
+            let confirmation = WSMessage::WorldUpdate {
                 region: RegionId(Uuid::new_v4()),
                 harmony_level: 0.75,
-            });
+            };
+            if let Some(frame) = encode_ws_message(&confirmation, wire_format) {
+                let _ = tx.send(frame);
+            }
         }
         WSMessage::EchoInteraction {
             echo_id,
@@ -223,19 +266,27 @@ async fn send_to_song_engine(event: SongEvent) {
 }
 
 async fn broadcast_harmony_update(state: &SharedGameState, region: &RegionId, level: f32) {
-    let players = {
-        let game_state = state.read().unwrap();
-        game_state.players.clone()
-    };
+    state.harmony_levels.insert(region.clone(), level);
 
     let update_message = WSMessage::WorldUpdate {
         region: region.clone(),
         harmony_level: level,
     };
 
-    for (_, player_session) in players {
-        if let Some(sender) = &player_session.sender {
-            let _ = sender.send(update_message.clone());
+    // Encode once per wire format and fan the shared frames out to every
+    // subscriber, instead of re-serializing per connection. Iteration only
+    // takes one shard's read lock at a time, so connects and disconnects on
+    // other shards proceed concurrently.
+    let json_frame = encode_ws_message(&update_message, WireFormat::Json);
+    let binary_frame = encode_ws_message(&update_message, WireFormat::Binary);
+
+    for player_session in state.players.iter() {
+        let frame = match player_session.wire_format {
+            WireFormat::Json => &json_frame,
+            WireFormat::Binary => &binary_frame,
+        };
+        if let (Some(sender), Some(frame)) = (&player_session.sender, frame) {
+            let _ = sender.send(frame.clone());
         }
     }
 }
@@ -245,7 +296,7 @@ async fn broadcast_harmony_update(state: &SharedGameState, region: &RegionId, le
 async fn main() -> Result<(), Box<dyn std::error::Error>> {
     logging::init(None);
 
-    let state = Arc::new(RwLock::new(GameState::new()));
+    let state = Arc::new(GameState::new());
     let monitor = Arc::new(HealthMonitor::new("websocket-gateway", env!("CARGO_PKG_VERSION")));
     let registry = LocalServiceRegistry::new();
     registry
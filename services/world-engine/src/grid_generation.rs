@@ -1,10 +1,31 @@
 // services/world-engine/src/grid_generation.rs
 use finalverse_world3d::{
-    terrain::{TerrainGenerator, TerrainPatch, Biome},
+    terrain::{TerrainGenerator, Biome},
     grid::Grid,
-    GridCoordinate,
+    GridCoordinate, PlayerId,
 };
 use anyhow::Result;
+use lru::LruCache;
+use std::collections::HashMap;
+use std::num::NonZeroUsize;
+use std::sync::Arc;
+use tokio::sync::{mpsc, Mutex};
+use tracing::debug;
+
+/// Finished grids kept in the LRU cache. A grid with terrain and entities is
+/// a few MB, so this bounds cache memory to a few GB at worst.
+const GRID_CACHE_CAPACITY: usize = 512;
+
+/// Harmony levels are quantized into this many buckets for cache keys, so a
+/// tiny harmony drift does not invalidate every cached grid in a region.
+const HARMONY_BUCKETS: f32 = 10.0;
+
+/// Depth of the speculative pre-generation queue. When it is full, new
+/// requests are dropped; pre-generation is best effort.
+const PREGEN_QUEUE_DEPTH: usize = 256;
+
+/// Background workers pulling from the pre-generation queue.
+const PREGEN_WORKERS: usize = 2;
 
 /// Basic metabolic information for a region
 #[derive(Debug, Clone, Copy)]
@@ -21,18 +42,79 @@ impl MetabolismTracker {
     }
 }
 
+/// Cache key for a finished grid: same coordinate, biome, and harmony bucket
+/// always produce the same terrain, so the grid can be shared.
+#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+struct GridCacheKey {
+    coord: GridCoordinate,
+    biome: Biome,
+    harmony_bucket: u8,
+}
+
+/// A unit of speculative work for the pre-generation workers.
+struct PreGenTask {
+    coord: GridCoordinate,
+    world_id: String,
+    biome_hint: Option<String>,
+}
+
 pub struct GridGenerationService {
     terrain_generator: TerrainGenerator,
     metabolism_tracker: MetabolismTracker,
+    cache: Mutex<LruCache<GridCacheKey, Arc<Grid>>>,
+    tracked_players: Mutex<HashMap<PlayerId, GridCoordinate>>,
+    pregen_tx: mpsc::Sender<PreGenTask>,
 }
 
 impl GridGenerationService {
+    /// Create the service and spawn its pre-generation worker pool. The
+    /// service is returned as an `Arc` because the workers hold a handle.
+    pub fn new(seed: u64) -> Arc<Self> {
+        let (pregen_tx, pregen_rx) = mpsc::channel(PREGEN_QUEUE_DEPTH);
+
+        let service = Arc::new(Self {
+            terrain_generator: TerrainGenerator::new(seed),
+            metabolism_tracker: MetabolismTracker,
+            cache: Mutex::new(LruCache::new(
+                NonZeroUsize::new(GRID_CACHE_CAPACITY).unwrap(),
+            )),
+            tracked_players: Mutex::new(HashMap::new()),
+            pregen_tx,
+        });
+
+        // Workers share one receiver; each locks it only long enough to pull
+        // the next task, then generates without holding anything.
+        let pregen_rx = Arc::new(Mutex::new(pregen_rx));
+        for _ in 0..PREGEN_WORKERS {
+            let service = service.clone();
+            let pregen_rx = pregen_rx.clone();
+            tokio::spawn(async move {
+                loop {
+                    let task = { pregen_rx.lock().await.recv().await };
+                    match task {
+                        Some(task) => {
+                            if let Err(e) = service
+                                .generate_grid(task.coord, &task.world_id, task.biome_hint.as_deref())
+                                .await
+                            {
+                                debug!("Pre-generation of grid {:?} failed: {}", task.coord, e);
+                            }
+                        }
+                        None => break,
+                    }
+                }
+            });
+        }
+
+        service
+    }
+
     pub async fn generate_grid(
         &self,
         coord: GridCoordinate,
         world_id: &str,
         biome_hint: Option<&str>,
-    ) -> Result<Grid> {
+    ) -> Result<Arc<Grid>> {
         // Get current metabolism state for the region
         let metabolism = self.metabolism_tracker.get_region_state(coord).await?;
 
@@ -42,6 +124,17 @@ impl GridGenerationService {
             _ => self.determine_biome_from_world(world_id, coord),
         };
 
+        let key = GridCacheKey {
+            coord,
+            biome,
+            harmony_bucket: quantize_harmony(metabolism.harmony_level),
+        };
+
+        // Cache hit: return the shared grid without touching the generator
+        if let Some(grid) = self.cache.lock().await.get(&key) {
+            return Ok(grid.clone());
+        }
+
         // Generate terrain
         let terrain = self.terrain_generator.generate_grid_terrain(
             coord,
@@ -49,11 +142,50 @@ impl GridGenerationService {
             biome,
         );
 
-        let grid = Grid::new(coord, terrain);
+        let grid = Arc::new(Grid::new(coord, terrain));
+
+        self.cache.lock().await.put(key, grid.clone());
 
         Ok(grid)
     }
 
+    /// Record a player's current grid and, when it changes, queue the ring of
+    /// surrounding grids for speculative generation so the next boundary
+    /// crossing is a cache hit.
+    pub async fn track_player(
+        &self,
+        player: PlayerId,
+        coord: GridCoordinate,
+        world_id: &str,
+        biome_hint: Option<&str>,
+    ) {
+        let moved = {
+            let mut tracked = self.tracked_players.lock().await;
+            tracked.insert(player, coord) != Some(coord)
+        };
+
+        if !moved {
+            return;
+        }
+
+        for neighbor in coord.neighbors() {
+            let task = PreGenTask {
+                coord: neighbor,
+                world_id: world_id.to_string(),
+                biome_hint: biome_hint.map(|s| s.to_string()),
+            };
+            // Best effort: drop work when the queue is saturated rather than
+            // backing up the caller.
+            if self.pregen_tx.try_send(task).is_err() {
+                debug!("Pre-generation queue full, skipping grid {:?}", neighbor);
+            }
+        }
+    }
+
+    pub async fn untrack_player(&self, player: &PlayerId) {
+        self.tracked_players.lock().await.remove(player);
+    }
+
     fn determine_first_hour_biome(&self, coord: GridCoordinate) -> Biome {
         match (coord.x, coord.y) {
             (100, 100) => Biome::MemoryGrotto,
@@ -67,3 +199,7 @@ impl GridGenerationService {
         Biome::Other
     }
 }
+
+fn quantize_harmony(harmony_level: f32) -> u8 {
+    (harmony_level.clamp(0.0, 1.0) * HARMONY_BUCKETS) as u8
+}
@@ -1,5 +1,6 @@
 // services/world-engine/src/lib.rs
 pub mod grid_generation;
+pub mod tick_scheduler;
 pub mod world;
 
 pub mod server;
@@ -0,0 +1,152 @@
+// services/world-engine/src/tick_scheduler.rs
+//
+// Variable-rate tick scheduling for world simulation. Regions with players
+// in them tick on every base tick; empty regions decay to a slow rate and
+// eventually hibernate entirely. A hibernating region is fast-forwarded
+// through the simulated time it missed when a player returns, so simulation
+// CPU tracks active players rather than world size.
+use crate::MetabolismSimulator;
+use dashmap::DashMap;
+use finalverse_core::RegionId;
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+
+/// Empty regions tick once every this many base ticks.
+pub const IDLE_TICK_DIVISOR: u32 = 10;
+
+/// How long a region stays idle (slow-ticking) after its last player leaves
+/// before it hibernates completely.
+const HIBERNATE_AFTER: Duration = Duration::from_secs(300);
+
+/// Upper bound on ticks replayed when waking a hibernated region, so a
+/// region empty for days doesn't stall the wake-up on a huge catch-up loop.
+const MAX_CATCHUP_TICKS: u32 = 360;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum TickRate {
+    Active,
+    Idle,
+    Hibernating,
+}
+
+struct RegionTickState {
+    occupants: usize,
+    last_occupied: Instant,
+    rate: TickRate,
+    /// Base ticks elapsed since this region last actually ran.
+    ticks_owed: u32,
+}
+
+impl RegionTickState {
+    fn new() -> Self {
+        Self {
+            occupants: 0,
+            last_occupied: Instant::now(),
+            rate: TickRate::Idle,
+            ticks_owed: 0,
+        }
+    }
+}
+
+pub struct TickScheduler {
+    regions: DashMap<RegionId, RegionTickState>,
+    metabolism: Arc<MetabolismSimulator>,
+}
+
+impl TickScheduler {
+    pub fn new(metabolism: Arc<MetabolismSimulator>) -> Self {
+        Self {
+            regions: DashMap::new(),
+            metabolism,
+        }
+    }
+
+    pub fn register_region(&self, region_id: RegionId) {
+        self.regions
+            .entry(region_id)
+            .or_insert_with(RegionTickState::new);
+    }
+
+    /// Note a player entering a region. Wakes a hibernated region, replaying
+    /// the (capped) simulated time it missed so its state is current before
+    /// the player sees it.
+    pub async fn player_entered(&self, region_id: &RegionId) {
+        let catchup = {
+            let mut entry = self
+                .regions
+                .entry(region_id.clone())
+                .or_insert_with(RegionTickState::new);
+            entry.occupants += 1;
+            entry.last_occupied = Instant::now();
+
+            let owed = entry.ticks_owed.min(MAX_CATCHUP_TICKS);
+            entry.ticks_owed = 0;
+            entry.rate = TickRate::Active;
+            owed
+        };
+
+        if catchup > 0 {
+            self.metabolism
+                .simulate_region_ticks(region_id, catchup)
+                .await;
+        }
+    }
+
+    pub fn player_left(&self, region_id: &RegionId) {
+        if let Some(mut entry) = self.regions.get_mut(region_id) {
+            entry.occupants = entry.occupants.saturating_sub(1);
+            if entry.occupants == 0 {
+                entry.last_occupied = Instant::now();
+                entry.rate = TickRate::Idle;
+            }
+        }
+    }
+
+    /// Run one base tick: occupied regions tick now, idle regions tick every
+    /// IDLE_TICK_DIVISOR base ticks (in a burst, so simulated time keeps
+    /// pace), hibernating regions only accrue time owed.
+    pub async fn tick(&self) {
+        // Pick up regions added directly through the metabolism simulator
+        for region_id in self.metabolism.region_ids().await {
+            self.register_region(region_id);
+        }
+
+        let mut due: Vec<(RegionId, u32)> = Vec::new();
+        for mut entry in self.regions.iter_mut() {
+            let region_id = entry.key().clone();
+            let state = entry.value_mut();
+            state.ticks_owed = state.ticks_owed.saturating_add(1);
+
+            if state.occupants == 0
+                && state.rate != TickRate::Hibernating
+                && state.last_occupied.elapsed() >= HIBERNATE_AFTER
+            {
+                state.rate = TickRate::Hibernating;
+            }
+
+            let run_now = match state.rate {
+                TickRate::Active => true,
+                TickRate::Idle => state.ticks_owed >= IDLE_TICK_DIVISOR,
+                TickRate::Hibernating => {
+                    state.ticks_owed = state.ticks_owed.min(MAX_CATCHUP_TICKS);
+                    false
+                }
+            };
+
+            if run_now {
+                due.push((region_id, state.ticks_owed));
+                state.ticks_owed = 0;
+            }
+        }
+
+        for (region_id, ticks) in due {
+            self.metabolism.simulate_region_ticks(&region_id, ticks).await;
+        }
+    }
+
+    /// Whether any region currently has players in it. Global simulations
+    /// (e.g. ecosystem migration) drop to the idle rate when this is false.
+    pub fn any_region_occupied(&self) -> bool {
+        self.regions.iter().any(|entry| entry.occupants > 0)
+    }
+}
@@ -25,9 +25,12 @@ impl EcosystemObserver for EcosystemAdapter {
         self.observer.notify(&world_event).await;
     }
 }
+use crate::tick_scheduler::{TickScheduler, IDLE_TICK_DIVISOR};
+use dashmap::DashMap;
 use std::collections::HashMap;
+use std::sync::atomic::{AtomicU32, Ordering};
 use std::sync::Arc;
-use tokio::sync::RwLock;
+use tokio::sync::{mpsc, RwLock};
 use serde::{Serialize, Deserialize};
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -79,27 +82,177 @@ pub enum WorldUpdate {
     EventTriggered { event: WorldEvent },
 }
 
+/// Commands handled by a region's actor task.
+enum RegionCommand {
+    Action(PlayerAction),
+    HarmonyChange(f32),
+}
+
+/// Handle to one independently scheduled region shard. The actor task owns
+/// all mutation of its RegionState; the per-region RwLock exists only so
+/// snapshot reads never stop the actor (and never touch other regions).
+pub struct RegionShard {
+    command_tx: mpsc::UnboundedSender<RegionCommand>,
+    state: Arc<RwLock<RegionState>>,
+}
+
+impl RegionShard {
+    fn spawn(
+        region_id: RegionId,
+        initial: RegionState,
+        event_tx: mpsc::UnboundedSender<WorldEvent>,
+    ) -> Self {
+        let state = Arc::new(RwLock::new(initial));
+        let (command_tx, mut command_rx) = mpsc::unbounded_channel();
+
+        let actor_state = state.clone();
+        tokio::spawn(async move {
+            while let Some(command) = command_rx.recv().await {
+                match command {
+                    RegionCommand::Action(action) => {
+                        // Region-scoped action processing; only this shard's
+                        // queue is involved
+                        match action.action {
+                            ActionType::Move(coords) => {
+                                println!("Player {} moved to {:?}", action.player_id.0, coords);
+                            }
+                            ActionType::Interact(target) => {
+                                println!("Player {} interacted with {}", action.player_id.0, target);
+                            }
+                            ActionType::UseAbility(ability) => {
+                                println!("Player {} used ability {}", action.player_id.0, ability);
+                            }
+                            ActionType::Craft(item) => {
+                                println!("Player {} crafted {}", action.player_id.0, item);
+                            }
+                        }
+                    }
+                    RegionCommand::HarmonyChange(delta) => {
+                        let restored = {
+                            let mut region = actor_state.write().await;
+                            let old_level = region.harmony_level;
+                            region.harmony_level =
+                                (region.harmony_level + delta as f64).clamp(0.0, 1.0);
+                            old_level < 0.5 && region.harmony_level >= 0.5
+                        };
+
+                        if restored {
+                            let _ = event_tx.send(WorldEvent::HarmonyRestored {
+                                region_id: region_id.clone(),
+                                amount: delta as f64,
+                            });
+                        }
+                    }
+                }
+            }
+        });
+
+        Self { command_tx, state }
+    }
+
+    async fn snapshot(&self) -> RegionState {
+        self.state.read().await.clone()
+    }
+}
+
 pub struct WorldEngine {
-    state: Arc<RwLock<WorldState>>,
+    regions: Arc<DashMap<RegionId, RegionShard>>,
+    time: Arc<RwLock<WorldTime>>,
+    active_events: Arc<RwLock<Vec<WorldEvent>>>,
+    region_event_tx: mpsc::UnboundedSender<WorldEvent>,
     metabolism: Arc<MetabolismSimulator>,
     ecosystem: Arc<EcosystemSimulator>,
+    tick_scheduler: Arc<TickScheduler>,
+    ecosystem_ticks_owed: AtomicU32,
     observers: Arc<RwLock<Vec<Arc<dyn Observer>>>>,
     update_queue: Arc<RwLock<Vec<WorldUpdate>>>,
 }
 
 impl WorldEngine {
     pub fn new() -> Self {
+        let active_events: Arc<RwLock<Vec<WorldEvent>>> = Arc::new(RwLock::new(Vec::new()));
+        let observers: Arc<RwLock<Vec<Arc<dyn Observer>>>> = Arc::new(RwLock::new(Vec::new()));
+
+        // Events emitted by region actors are collected here and fanned out
+        // to observers without the actors taking any shared lock
+        let (region_event_tx, mut region_event_rx) = mpsc::unbounded_channel();
+        {
+            let active_events = active_events.clone();
+            let observers = observers.clone();
+            tokio::spawn(async move {
+                while let Some(event) = region_event_rx.recv().await {
+                    for observer in observers.read().await.iter() {
+                        observer.notify(&event).await;
+                    }
+                    active_events.write().await.push(event);
+                }
+            });
+        }
+
+        let metabolism = Arc::new(MetabolismSimulator::new());
+
         Self {
-            state: Arc::new(RwLock::new(WorldState::new())),
-            metabolism: Arc::new(MetabolismSimulator::new()),
+            regions: Arc::new(DashMap::new()),
+            time: Arc::new(RwLock::new(WorldTime::default())),
+            active_events,
+            region_event_tx,
+            tick_scheduler: Arc::new(TickScheduler::new(metabolism.clone())),
+            ecosystem_ticks_owed: AtomicU32::new(0),
+            metabolism,
             ecosystem: Arc::new(EcosystemSimulator::new()),
-            observers: Arc::new(RwLock::new(Vec::new())),
+            observers,
             update_queue: Arc::new(RwLock::new(Vec::new())),
         }
     }
 
+    /// Promote a region to its own actor shard.
+    pub fn add_region(&self, region: RegionState) {
+        let region_id = region.id.clone();
+        let shard = RegionShard::spawn(region_id.clone(), region, self.region_event_tx.clone());
+        self.tick_scheduler.register_region(region_id.clone());
+        self.regions.insert(region_id, shard);
+    }
+
+    /// Tell the tick scheduler a player entered a region, waking it (with
+    /// catch-up) if it was hibernating.
+    pub async fn player_entered_region(&self, region_id: &RegionId) {
+        self.tick_scheduler.player_entered(region_id).await;
+    }
+
+    pub fn player_left_region(&self, region_id: &RegionId) {
+        self.tick_scheduler.player_left(region_id);
+    }
+
+    /// Queue an action on one region's shard. Returns false if the region is
+    /// unknown.
+    pub fn queue_region_action(&self, region_id: &RegionId, action: PlayerAction) -> bool {
+        match self.regions.get(region_id) {
+            Some(shard) => shard.command_tx.send(RegionCommand::Action(action)).is_ok(),
+            None => false,
+        }
+    }
+
+    /// Consistent point-in-time view for cross-region queries. Each region is
+    /// snapshotted from its own shard; global_harmony is derived from the
+    /// snapshot rather than maintained under a global lock.
     pub async fn get_state(&self) -> WorldState {
-        self.state.read().await.clone()
+        let mut regions = HashMap::new();
+        for entry in self.regions.iter() {
+            regions.insert(entry.key().clone(), entry.value().snapshot().await);
+        }
+
+        let global_harmony = if regions.is_empty() {
+            0.5
+        } else {
+            (regions.values().map(|r| r.harmony_level).sum::<f64>() / regions.len() as f64) as f32
+        };
+
+        WorldState {
+            regions,
+            global_harmony,
+            active_events: self.active_events.read().await.clone(),
+            time: self.time.read().await.clone(),
+        }
     }
 
     pub async fn register_observer(&self, observer: Arc<dyn Observer>) {
@@ -137,29 +290,35 @@ impl WorldEngine {
         }
 
         // Update world time
-        let mut state = self.state.write().await;
-        state.time.advance(delta_time);
+        self.time.write().await.advance(delta_time);
     }
 
     async fn apply_update(&self, update: WorldUpdate) {
-        let mut state = self.state.write().await;
-
         match update {
             WorldUpdate::HarmonyChange { region_id, delta } => {
-                if let Some(region) = state.regions.get_mut(&region_id) {
-                    region.harmony_level = (region.harmony_level + delta as f64).clamp(0.0, 1.0);
+                // Routed to the owning shard; no other region is touched
+                if let Some(shard) = self.regions.get(&region_id) {
+                    let _ = shard.command_tx.send(RegionCommand::HarmonyChange(delta));
                 }
             }
             WorldUpdate::EventTriggered { event } => {
-                state.active_events.push(event);
+                self.active_events.write().await.push(event);
             }
         }
     }
 
     pub async fn simulate_tick(&self) {
-        // Run all simulations
-        self.metabolism.simulate_tick().await;
-        self.ecosystem.simulate_tick().await;
+        // Metabolism ticks per region at whatever rate the scheduler decides
+        self.tick_scheduler.tick().await;
+
+        // Ecosystem simulation is species-level, not per region, so it can
+        // only throttle globally: full rate while anyone is online, idle
+        // rate otherwise
+        let owed = self.ecosystem_ticks_owed.fetch_add(1, Ordering::Relaxed) + 1;
+        if self.tick_scheduler.any_region_occupied() || owed >= IDLE_TICK_DIVISOR {
+            self.ecosystem_ticks_owed.store(0, Ordering::Relaxed);
+            self.ecosystem.simulate_tick().await;
+        }
 
         // Check for celestial events
         if rand::random::<f64>() < 0.01 {